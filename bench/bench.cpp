@@ -0,0 +1,397 @@
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <bench/measure.h>
+#include <bench/report.h>
+#include <code_gen/code_gen.h>
+#include <interp/interpreter.h>
+#include <jit/jit.h>
+#include <lex/lexer.h>
+#include <optimize/pass_manager.h>
+#include <parse/parser.h>
+
+namespace {
+
+struct level_t {
+  const char* name;
+  unsigned    level;
+};
+
+// the optimization levels main.cpp offers
+const level_t levels[] = {
+  { "O0", 0 },
+  { "O1", 1 },
+  { "O2", 2 },
+  { "O3", 3 }
+};
+
+struct settings {
+  std::vector<std::string> paths;
+  std::vector<std::string> backends = { "interp", "jit", "c", "llvm" };
+  std::string              inputs;
+  std::string              csv;
+  std::string              json;
+  std::string              cc      = "cc";
+  std::string              lli     = "lli";
+  double                   timeout = 60;
+  unsigned                 repeat  = 1;
+};
+
+void dump_help(const char** argv);
+std::vector<std::string> collect(const std::vector<std::string>& paths);
+std::string find_input(const std::string& program, const std::string& inputs);
+bool wanted(const settings& s, const char* backend);
+bool split(std::vector<std::string>& out, const char* list);
+
+std::string quote(const std::string& s) {
+  std::string q = "'";
+  for (char c : s) {
+    if (c == '\'') q += "'\\''";
+    else           q += c;
+  }
+  return q + "'";
+}
+
+bool same_output(const bf::bench::sample& a, const bf::bench::sample& b) {
+  return a.out_bytes == b.out_bytes && a.out_hash == b.out_hash;
+}
+
+bool finished(const bf::bench::sample& s) {
+  return s.status == bf::bench::status_t::ok || s.status == bf::bench::status_t::fault;
+}
+
+// the fastest of repeat runs with the largest footprint seen, a run that
+// doesn't succeed is returned as is
+bf::bench::sample best_of(unsigned repeat, const std::function<int()>& body, const std::string& input, double timeout) {
+  auto best = bf::bench::measure(body, input, timeout);
+  for (unsigned i = 1; i < repeat && best.status == bf::bench::status_t::ok; ++i) {
+    auto s = bf::bench::measure(body, input, timeout);
+    if (s.status != bf::bench::status_t::ok) return s;
+    best.wall    = std::min(best.wall, s.wall);
+    best.peak_kb = std::max(best.peak_kb, s.peak_kb);
+  }
+  return best;
+}
+
+// runs the interpreter counting every instruction it executes. the child
+// hands the total back through a pipe, ops stays 0 if it never arrives
+bf::bench::sample count_ops(const bf::ir::program& code, const std::string& input, double timeout, std::uint64_t& ops) {
+  int fds[2];
+  if (pipe(fds) != 0) throw std::runtime_error{ "could not create a pipe" };
+
+  auto s = bf::bench::measure([&] {
+    close(fds[0]);
+    bf::interp::interpreter interp{ code };
+    std::vector<std::uint64_t> counts;
+    int rc = interp.run(counts);
+
+    // the trailing halt isn't part of the program
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i + 1 < counts.size(); ++i) total += counts[i];
+    if (write(fds[1], &total, sizeof(total)) != sizeof(total)) return 127;
+    return rc;
+  }, input, timeout);
+  close(fds[1]);
+
+  ops = 0;
+  if (read(fds[0], &ops, sizeof(ops)) != sizeof(ops)) ops = 0;
+  close(fds[0]);
+  return s;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[]) {
+  settings s;
+
+  for (int i = 1; i < argc; ++i) {
+    const char* arg = argv[i];
+
+    if (*arg != '-') {
+      s.paths.push_back(arg);
+    }
+    else if (std::strncmp(arg, "--csv=", 6) == 0) {
+      s.csv = arg + 6;
+    }
+    else if (std::strncmp(arg, "--json=", 7) == 0) {
+      s.json = arg + 7;
+    }
+    else if (std::strncmp(arg, "--inputs=", 9) == 0) {
+      s.inputs = arg + 9;
+    }
+    else if (std::strncmp(arg, "--backends=", 11) == 0) {
+      if (!split(s.backends, arg + 11)) {
+        std::cerr << "unknown backend in: " << arg << '\n';
+        return 1;
+      }
+    }
+    else if (std::strncmp(arg, "--cc=", 5) == 0) {
+      s.cc = arg + 5;
+    }
+    else if (std::strncmp(arg, "--lli=", 6) == 0) {
+      s.lli = arg + 6;
+    }
+    else if (std::strncmp(arg, "--timeout=", 10) == 0) {
+      s.timeout = std::atof(arg + 10);
+    }
+    else if (std::strncmp(arg, "--repeat=", 9) == 0) {
+      s.repeat = static_cast<unsigned>(std::max(1, std::atoi(arg + 9)));
+    }
+    else if (std::strcmp(arg, "-h") == 0) {
+      dump_help(argv);
+      return 1;
+    }
+    else {
+      std::cerr << "unexpected argument: " << arg << '\n';
+      dump_help(argv);
+      return 1;
+    }
+  }
+
+  if (s.paths.empty()) {
+    std::cerr << "no input\n";
+    dump_help(argv);
+    return 1;
+  }
+
+  using namespace bf;
+
+  // backends that need a tool we don't have are left out rather than failed
+  bool use_interp = wanted(s, "interp");
+  bool use_jit    = wanted(s, "jit") && jit::supported();
+  bool use_c      = wanted(s, "c") && bench::shell(s.cc + " --version") == 0;
+  bool use_llvm   = wanted(s, "llvm") && bench::shell(s.lli + " --version") == 0;
+  if (wanted(s, "jit") && !use_jit)   std::cerr << "skipping jit: not supported on this platform\n";
+  if (wanted(s, "c") && !use_c)       std::cerr << "skipping c: " << s.cc << " not found\n";
+  if (wanted(s, "llvm") && !use_llvm) std::cerr << "skipping llvm: " << s.lli << " not found\n";
+
+  std::string tmp = "/tmp";
+  if (const char* dir = std::getenv("TMPDIR")) tmp = dir;
+  tmp += "/bf_bench.XXXXXX";
+  if (!mkdtemp(&tmp[0])) {
+    std::cerr << "could not create a directory in " << tmp << '\n';
+    return 1;
+  }
+  const std::string c_file  = tmp + "/prog.c";
+  const std::string exe     = tmp + "/prog";
+  const std::string ll_file = tmp + "/prog.ll";
+
+  std::vector<bench::row> rows;
+  auto add = [&](const std::string& program, const char* backend, const level_t& lvl, const bench::sample& run, std::uint64_t ops, const bench::sample* reference) {
+    bench::row r;
+    r.program = program;
+    r.backend = backend;
+    r.level   = lvl.name;
+    r.run     = run;
+    r.ops     = ops;
+    if (reference && finished(*reference) && finished(run)) {
+      r.output = same_output(run, *reference) ? "match" : "differ";
+    }
+    std::cerr << program << ' ' << backend << ' ' << lvl.name << ": " << bench::to_string(run.status)
+              << ' ' << run.wall * 1000 << "ms" << (*r.output ? " output " : "") << r.output << '\n';
+    rows.push_back(std::move(r));
+  };
+
+  try {
+    for (const auto& program : collect(s.paths)) {
+      ir::program code;
+      try {
+        lex::lexer l{ program };
+        parse::parser p{ l };
+        code = p.parse_ir();
+        if (ir::ill_formed(code)) {
+          for (const auto& e : p.errors()) std::cerr << e << '\n';
+          continue;
+        }
+      }
+      catch (const std::exception& e) {
+        std::cerr << "failed to open file: " << program << ": " << e.what() << '\n';
+        continue;
+      }
+      auto input = find_input(program, s.inputs);
+
+      constexpr std::size_t n_levels = sizeof(levels) / sizeof(levels[0]);
+      std::vector<ir::program>   lvl_codes(n_levels, code);
+      std::vector<bench::sample> counted(n_levels);
+      std::vector<std::uint64_t> lvl_ops(n_levels, 0);
+
+      // the most optimized level is counted first, a program that never
+      // stops then costs one timeout rather than one per level
+      for (std::size_t i = n_levels; i-- > 0; ) {
+        optimize::pass_manager::level(levels[i].level).run(lvl_codes[i]);
+        counted[i] = count_ops(lvl_codes[i], input, s.timeout, lvl_ops[i]);
+        if (i + 1 == n_levels && !finished(counted[i])) break;
+      }
+      if (!finished(counted[n_levels - 1])) {
+        std::cerr << "skipping " << program << ": the interpreter did not finish within " << s.timeout << "s\n";
+        add(program, "interp", levels[n_levels - 1], counted[n_levels - 1], 0, nullptr);
+        continue;
+      }
+
+      // the least optimized level that finishes is what every run is held to
+      auto reference = std::find_if(counted.begin(), counted.end(), finished);
+      for (std::size_t i = 0; i < n_levels; ++i) {
+        const auto& lvl      = levels[i];
+        const auto& lvl_code = lvl_codes[i];
+        const auto  ops      = lvl_ops[i];
+        if (!finished(counted[i])) {
+          std::cerr << "skipping " << program << ' ' << lvl.name << ": the interpreter did not finish within " << s.timeout << "s\n";
+          add(program, "interp", lvl, counted[i], 0, nullptr);
+          continue;
+        }
+
+        if (use_interp) {
+          add(program, "interp", lvl, best_of(s.repeat, [&] {
+            interp::interpreter interp{ lvl_code };
+            return interp.run();
+          }, input, s.timeout), ops, &*reference);
+        }
+
+        if (use_jit) {
+          add(program, "jit", lvl, best_of(s.repeat, [&] {
+            jit::executable exe{ lvl_code };
+            return exe.run();
+          }, input, s.timeout), ops, &*reference);
+        }
+
+        if (use_c) {
+          code_gen::make_generator(code_gen::target_t::c, lvl_code, c_file)->emit();
+          bench::sample run;
+          if (bench::shell(s.cc + " -O2 -o " + quote(exe) + ' ' + quote(c_file)) != 0) {
+            run.status = bench::status_t::error;
+          }
+          else {
+            run = best_of(s.repeat, [&] {
+              execl(exe.c_str(), exe.c_str(), static_cast<char*>(nullptr));
+              return 127;
+            }, input, s.timeout);
+          }
+          add(program, "c", lvl, run, ops, &*reference);
+        }
+
+        if (use_llvm) {
+          code_gen::make_generator(code_gen::target_t::llvm, lvl_code, ll_file)->emit();
+          auto command = s.lli + ' ' + quote(ll_file);
+          add(program, "llvm", lvl, best_of(s.repeat, [&] {
+            execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+            return 127;
+          }, input, s.timeout), ops, &*reference);
+        }
+      }
+    }
+  }
+  catch (const std::exception& e) {
+    std::cerr << "benchmark failed: " << e.what() << '\n';
+    return 1;
+  }
+
+  unlink(c_file.c_str());
+  unlink(exe.c_str());
+  unlink(ll_file.c_str());
+  rmdir(tmp.c_str());
+
+  if (s.csv.empty() && s.json.empty()) {
+    bench::write_csv(std::cout, rows);
+    return 0;
+  }
+  if (!s.csv.empty()) {
+    std::ofstream out{ s.csv };
+    if (!out) {
+      std::cerr << "failed to open file: " << s.csv << '\n';
+      return 1;
+    }
+    bench::write_csv(out, rows);
+  }
+  if (!s.json.empty()) {
+    std::ofstream out{ s.json };
+    if (!out) {
+      std::cerr << "failed to open file: " << s.json << '\n';
+      return 1;
+    }
+    bench::write_json(out, rows);
+  }
+  return 0;
+}
+
+namespace {
+
+void dump_help(const char** argv) {
+  std::cerr << "Usage: " << argv[0] << " [--csv=file] [--json=file] [--inputs=dir] [--backends=interp,jit,c,llvm] [--cc=command] [--lli=command] [--timeout=seconds] [--repeat=n] [-h help]"
+            << " program_or_directory..." << std::endl;
+}
+
+// directories contribute the .bf files directly inside them, in name order
+std::vector<std::string> collect(const std::vector<std::string>& paths) {
+  std::vector<std::string> programs;
+  for (const auto& path : paths) {
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+      programs.push_back(path);
+      continue;
+    }
+
+    std::vector<std::string> found;
+    while (dirent* e = readdir(dir)) {
+      std::string name = e->d_name;
+      if (name.size() > 3 && name.compare(name.size() - 3, 3, ".bf") == 0) {
+        found.push_back(path + '/' + name);
+      }
+    }
+    closedir(dir);
+
+    std::sort(found.begin(), found.end());
+    programs.insert(programs.end(), found.begin(), found.end());
+  }
+  return programs;
+}
+
+// a program's input is the .in file of the same name beside it or in the
+// inputs directory, programs without one read EOF straight away
+std::string find_input(const std::string& program, const std::string& inputs) {
+  auto stem  = program.substr(0, program.rfind('.'));
+  auto slash = stem.rfind('/');
+  auto name  = slash == std::string::npos ? stem : stem.substr(slash + 1);
+
+  std::vector<std::string> candidates{ stem + ".in" };
+  if (!inputs.empty()) candidates.push_back(inputs + '/' + name + ".in");
+  for (const auto& candidate : candidates) {
+    if (std::ifstream{ candidate }) return candidate;
+  }
+  return "";
+}
+
+bool wanted(const settings& s, const char* backend) {
+  return std::find(s.backends.begin(), s.backends.end(), backend) != s.backends.end();
+}
+
+bool split(std::vector<std::string>& out, const char* list) {
+  static const char* const known[] = { "interp", "jit", "c", "llvm" };
+
+  out.clear();
+  std::string name;
+  for (const char* c = list; ; ++c) {
+    if (*c != ',' && *c != '\0') {
+      name += *c;
+      continue;
+    }
+    if (std::find_if(std::begin(known), std::end(known), [&](const char* k) { return name == k; }) == std::end(known)) return false;
+    out.push_back(name);
+    name.clear();
+    if (*c == '\0') return true;
+  }
+}
+
+} // namespace
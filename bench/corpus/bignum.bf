@@ -0,0 +1,13 @@
+big powers of two
+doubles a decimal number held one digit per element 7680 times printing it
+every 128 doublings
+
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++>>>>>>>>>>>>>>>>+>+<<<<<<<
+<<<<<<<<<<<<[->>[-<+>>+<]>[-<+>]<<[->>>>>>>>>>>>>>>>>[>[->>++<<]>[->+<]>
+>>++++++++++<<[->+>-[>+>>]>[+[-<+>]>+>>]<<<<<<]>[-]>[-]>[-<<<<<+>>>>>]>[
+->>>>>+<<<<<]<<<<<<<>>>>>>>>>>]>>[-<+<+>>]<<<<<<<<<<<<[<<<<<<<<<<]<<<<<<
+<]>>>>>>>>>>>>>>>>>[>>>>>>>>>>]<<<<<<<<<<[>+++++++++++++++++++++++++++++
++++++++++++++++++++.------------------------------------------------<<<<
+<<<<<<<]<<<<<++++++++++.[-]<<<]
@@ -0,0 +1,622 @@
+factor
+reads decimal numbers below 65536 one per line and prints the prime
+factors of each
+numbers are held in pairs of cells and divided by repeated subtraction
+so most of the time goes to moving values between cells
+
+>>>>>>>,[[-<<<<<<<+>>>>>+>>]<<[->>+<<]<<<<<----------[[-]>>>>>>>>>>>[-<<
+<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->[-]++++++++++[->>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<[-]+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>
+>>>>>>>>>+<<<<<<<<<<<<]<[<[-]>[-]]<[>>>>>>>>>>>>>+<<<<<<<<<<<<<[-]]<]<]>
+>>>>>>>>[->>>>>>++++++++++<<<<<<]>>>>>>[-<<<<<<+>>>>>>]>[-<<<<<<+>>>>>>]
+<<<<<<<<<<------------------------------------------------[->>>>+<<<<<<<
+<[-]+>>>>>>>>[-<<<<<<<+>+>>>>>>]<<<<<<[->>>>>>+<<<<<<]<[<[-]>[-]]<[>>>>>
+>>+<<<<<<<[-]]>>>>],[-<<<<<<<+>>>>>+>>]<<[->>+<<]<<<<<----------]>>>>>>>
+>>>[->>>>>>>>+<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>[->>>>>>>>+<<
+<<<<<<<<<<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-]++
+++++++++<<<<<<<<<<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<
+[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<
+[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[
+<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->
+>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]
+>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<
+<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]
+>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<
+<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->+<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]<<<[
+->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>
+>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-
+]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<
+<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>
+>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<
+<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+
+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>[-
+]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<
+<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<-
+>>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]>>>>>
+>>>>>>>>>>>[->>+<<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>
+>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
++>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>
+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<
+<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-
+]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<
+<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>
+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>
+>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<
+<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[
+-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>
+[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->>>+<<
+<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-
+]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>
+>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>
+[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<
+<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->
+>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<
+<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
++>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<
+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<
+<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>
+>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<
+[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->>>>+<<<<]<<<<<[-]>[-]>
+[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<
+[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<
+<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<
+[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[
+<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<
+<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->
+>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]
+>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<
+<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<
+<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]
+>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<
+<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->>>>>+<<<<<]<<<<<[-]>[-]>[-<<+>>]>[-<<
++>>]>>>>>>>>>[-]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>
+>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++
+++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>
+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>
+>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>
+>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<
+<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>
+>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>[-]<++++++++++++++++++++++++++++++++++
+++++++++++++++.[-]>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++++
++++++++++++++++++++++++++++++++++++++++++.[-]>>>>>>>>>[-]++<[-]+[>>[->>+
+<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>[->>+<<<<<<<<+>>>>>>]<<<<<<[->>>>
+>>+<<<<<<]>>[-]+>>>>>>[-<<<<<<<<<<<<<+>>>>>+>>>>>>>>]<<<<<<<<[->>>>>>>>+
+<<<<<<<<]>>>>[-<<<<<<<<+>>>>+>>>>]<<<<[->>>>+<<<<]<<<[-]<[->>>[-]+<<<<[-
+>>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<
+[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>+>>>>>>>]<<<<<<<[->
+>>>>>>+<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>[-<<<<<<<<<<<<<
++>>>>>+>>>>>>>>]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>[-<<<<<<<<+>>>>+>>>>]<<<
+<[->>>>+<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[
+-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>-<<<<<<<<<<[-]]>>>>>>
+>[-<<<<<<<<<+>>>>>+>>>>]<<<<[->>>>+<<<<]<<<<<[->>>>>>>>>>>>>-<<<<<<<<<<<
+<<]>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>
+>>+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>[-<<<<<<<<<<<<<+>>>>>+>>>>>>>>
+]<<<<<<<<[->>>>>>>>+<<<<<<<<]>>>>[-<<<<<<<<+>>>>+>>>>]<<<<[->>>>+<<<<]<<
+<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>
+[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>[-<<<<<<<<<<<<+>>>>
+>+>>>>>>>]<<<<<<<[->>>>>>>+<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]<
+<<<<<<[-]+>>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>+>>>>>>>>]<<<<<<<<[->>>>>>>>+<
+<<<<<<<]<<<<[<[-]>[-]][-]+<[>[-]>++++++++++++++++++++++++++++++++.[-]>>>
+>>>>>>>>>>>[-]<<<<<<<[->>>>>>>>+<<<<<<<<<<<<<<<+>>>>>>>]<<<<<<<[->>>>>>>
++<<<<<<<]>>>>>>>>>>>>>>[->>+<<<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<<[->>>>>
+>>>>>>+<<<<<<<<<<<]>>>>>>>>>>>>[->>+<<<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<
+<<<<[->>>>>>>>>>>>+<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++<<
+<<<<<<<<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>
+>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[
+-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>
+[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<
+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<
+]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-
+]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<
+<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>
+>>>>>]>>>>>>>>>>>>>>>>[->+<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<
+<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<
+]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[
+-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>
+>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>
+>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[
+-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>
+>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-
+]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>
+>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[
+-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<
+<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>
+>[->>+<<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>
++<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>
+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>
+]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]
+>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>
+>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-
+]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<
+<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-
+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>
+>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->
+>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[
+-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>
++>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->>>+<<<]<<<<<[-]
+>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<
+<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[
+-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-
+]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<
++<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>
+[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<
+<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-
+]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->>>>+<<<<]<<<<<[-]>[-]>[-<<+>>]>[
+-<<+>>]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>
+>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[
+-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<
+<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[
+-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>
+[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<
+[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<
+]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<
+<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-
+]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<
+<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>
+>>>>>]>>>>>>>>>>>>>>>>[->>>>>+<<<<<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]>>>>>>
+>>>[-]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<]<<
+<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++++++++
+++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++
++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>
+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>++
+++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<<<<<<<<
+<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>+++++++
++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<<<<<<<<[-]]>
+>>>>>>>>>>>>>>>>>>>>>>>>[-]<++++++++++++++++++++++++++++++++++++++++++++
+++++.[-]>>>>>[-]<<<<<<<<<<<<[-]<<<<<<<[-]>[-]>>>[-<<<<+>>>>]>[-<<<<+>>>>
+]<<<<<<<<<<<<[-]>>>>>>>>[-<<<<<+<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>-[<<<[-]
++>>>[-]]>>>>[-<<<<+<+>>>>>]<<<<<[->>>>>+<<<<<]>[<<<[-]+>>>[-]]<<<<[-]+>[
+<[-]>[-]]<[>>>>>>[-]<<<<<<[-]]<<[-]]>[>>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>+
+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+<<<<<<<<<<]>>>>[-<<<<<<+>>+>>>>]<<<<[-
+>>>>+<<<<]<[-]<[-<<<[-]+>>[->>>>+<+<<<]>>>[-<<<+>>>]>[<<<<<<[-]>>->>>>[-
+]]<<<<<<[>>>>+<[-]<<<[-]]>>>]<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>+>>>>>>>>
+>]<<<<<<<<<[->>>>>>>>>+<<<<<<<<<]<<<[>>[-]<<[-]]<<[-]+>>>>[>>>>[-]<<<<<<
+<<[-]>>>>[-]]<<<<[>>>>>>>>>+<<<<<<<<<[-]]>>>>>>>>>[-<<<<<<<+>>>+>>>>]<<<
+<[->>>>+<<<<]<<[-]+<[>[-]<[-]]>[>>>>>[-]<<<<<[-]]<<[-]]>>>>>>>>>>>>>[-]>
+[-]<<<[-]>[-]<<<<<]<<<<<<[-]>>>>>>>>>[-<<<<<<<<<<<+>>>>>+>>>>>>]<<<<<<[-
+>>>>>>+<<<<<<]<<<<<-[>>[-]+<<[-]]>>>>>>>>>>[-<<<<<<<<<<+>>>>>+>>>>>]<<<<
+<[->>>>>+<<<<<]<<<<<[>>[-]+<<[-]]>>[>++++++++++++++++++++++++++++++++.[-
+]>>>>>>>[->>>>>>>>+<<<<<<<<<<<<<+>>>>>]<<<<<[->>>>>+<<<<<]>>>>>>[->>>>>>
+>>+<<<<<<<<<<<<<<+>>>>>>]<<<<<<[->>>>>>+<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>
+[-]++++++++++<<<<<<<<<<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<
+<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[
+-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-
+]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<
++<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>
+[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<
+<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-
+]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->+<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>
+]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[
+->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<
+<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<
+<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+
+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>
+>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
+<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>
+>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>
+>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]
+<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[-
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]
+>>>>>>>>>>>>>>>>[->>+<<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>
+>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
++>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>
+>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<
+<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>
+>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>
+[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>
+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>
+>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<
+<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>
+>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<
+<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>
+>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-
+]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[
+->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[
+-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
+<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->
+>>+<<<]<<<<<[-]>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<]>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>
+>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<
+<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>
+>>>>>[>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>
+]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<
+<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<
+<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<
+<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<
+<<<<<<<[->>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>
++>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]
+>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]
+<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->>>>+<<<<]<<<<<[-]
+>[-]>[-<<+>>]>[-<<+>>]<<<[->>>>+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<
+<<<<<[->>>>>>>>>>>>>+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[->>>>+<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+<<<<<<<<<<<<<<]>>[-]+>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<
+<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[
+-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<[->>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-]+<<<<<<<[-]]>>>>>>>[>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<
+<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-
+]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<
++<[-]>>>[-]]<<<]<[-]>>[>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<<<<[-]]>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[->>>>>>>>>>>>>>>>>>>>>>>-<<<<<<<<<<<<<<<<<
+<<<<<<]>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>
+>>>[-<<<<<<<<<<<<<<<<<<<<+>>>>+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<]<<<<[<[-]>[-]]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<[-]]>>>>>>>[-]+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>+>
+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<]<<<[-]<[->>>[-]+<<<<[->>>+>>+<<<<<]>>>>>
+[-<<<<<+>>>>>]<<[>[-]<<<<->>>[-]]>[<<+<[-]>>>[-]]<<<]<[-]>>[>>>>>[-]<<<<
+<[-]]>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>
+>]<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>[-
+]+<<<<<<<[-]]>>>>>>>]>>>>>>>>>>>>>>>>[->>>>>+<<<<<]<<<<<[-]>[-]>[-<<+>>]
+>[-<<+>>]>>>>>>>>>[-]<<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
+<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>
+>>>+>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>
+>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<
+<[->>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>
+>>>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<
+<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<[-<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<[->>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]+<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<[->
+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<]<<<<<[>>>>>>>>>>>>>>>>>
+>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<<<
+<<<<<<<<<<[-]]>>>>>>>>>>>>>>>>>>>>>>>>>[-]<+++++++++++++++++++++++++++++
++++++++++++++++++++.[-]>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]>>>>>>>>[-
+]>[-]<<[-]<<<<<<<<<++++++++++.[-]>>>>>>>,]
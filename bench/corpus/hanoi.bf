@@ -0,0 +1,49 @@
+towers of hanoi
+moves a tower of 24 disks from peg A to peg C and prints the moves of the
+ten largest disks
+each disk keeps a bit of a binary move counter and the peg it sits on
+a move flips the lowest clear bit and rotates that disk one peg along in
+the direction its parity gives it
+
+>>>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>
+>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>
+>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>
+>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>>+>>>>>>>>>>
+>+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>+>>>>>>>>
++>>>>>>>>>>>+>>>+>>>>>>>>+>>>>>>>>>>>+>>>+>>>>>>>>+>>>>>>>>>>>+>>>+>>>>>
+>>>+>>>>>>>>>>>+>>>+>>>>>>>>+>>>>>>>>>>>+>>>+>>>>>>>>+>>>>>>>>>>>+>>>+>>
+>>>>>>+>>>>>>>>>>>+<+>>>>+>>>>>>>>+<+>>>>>>>>>>>>+<+>>>>+>>>>>>>>+<+>>>>
+>>>>>>>>+<+>>>>+>>>>>>>>+<+>>>>>>>>>>>>+<+>>>>+>>>>>>>>+<+>>>>>>>>>>>>+<
++>>>>+>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[>
+>>>>>>>>>>>>>[->>>>>>>>>>>]+<>>[->>>>>+>+<<<<<<]>>>>>>[-<<<<<<+>>>>>>]<[
+<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->>>>+<<<<]>>>>[-<++<<<+>>>>]<
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.[-]+++
++++++++++++++++++++++++++++++.+++++++++++++.+++++++++++++++++.----------
+--------------------.[-]<[-]]<[->>+>+<<<]>>>[-<<<+>>>]+<[<<<[->>>>>+<<<<
+<]<[->+<]<[->+<]>>>>>>>[-<<<<<<<+>>>>>>>]<[-]<[-]]>[<<<<<<[->>>>>>>+<<<<
+<<<]>[-<+>]>[-<+>]>>>>>[-<<<<<+>>>>>]<[-]]<<<<<<<[->>>>>+>+<<<<<<]>>>>>>
+[-<<<<<<+>>>>>>]<[<<<[->>>>+>+<<<<<]>>>>>[-<<<<<+>>>>>]<<<<[->>>>+<<<<]>
+>>>[-<++<<<+>>>>]<++++++++++++++++++++++++++++++++++++++++++++++++++++++
++++++++++++.[-]++++++++++.[-]<[-]]<<<<<<<[<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<]
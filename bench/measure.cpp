@@ -0,0 +1,158 @@
+#include <bench/measure.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace bf {
+
+namespace bench {
+
+namespace {
+
+constexpr std::uint64_t fnv_basis = 14695981039346656037ull;
+constexpr std::uint64_t fnv_prime = 1099511628211ull;
+
+long max_rss_kb(const rusage& usage) {
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024; // bytes there, kilobytes everywhere else
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+// the child leaves through _exit so it never runs the parent's atexit
+// handlers or flushes the parent's buffers a second time. before anything
+// else it reports the resident set it inherited from the harness through
+// base, the peak it reaches is measured from there
+[[noreturn]] void run_child(const std::function<int()>& body, const std::string& input, int out, int base) {
+  rusage self{ };
+  getrusage(RUSAGE_SELF, &self);
+  long inherited = max_rss_kb(self);
+  if (write(base, &inherited, sizeof(inherited)) != sizeof(inherited)) _exit(127);
+  close(base);
+
+  setpgid(0, 0);
+  int in = open(input.empty() ? "/dev/null" : input.c_str(), O_RDONLY);
+  if (in < 0 || dup2(in, 0) < 0 || dup2(out, 1) < 0) _exit(127);
+  close(in);
+  close(out);
+
+  int rc = 127;
+  try {
+    rc = body();
+  }
+  catch (...) { }
+  std::fflush(stdout);
+  _exit(rc);
+}
+
+} // namespace
+
+const char* to_string(status_t status) {
+  switch (status) {
+    case status_t::ok:      return "ok";
+    case status_t::fault:   return "fault";
+    case status_t::timeout: return "timeout";
+    case status_t::error:   return "error";
+  }
+  return "";
+}
+
+sample measure(const std::function<int()>& body, const std::string& input, double timeout) {
+  using clock = std::chrono::steady_clock;
+
+  int out[2];
+  int base[2];
+  if (pipe(out) != 0) throw std::runtime_error{ "could not create a pipe" };
+  if (pipe(base) != 0) {
+    close(out[0]);
+    close(out[1]);
+    throw std::runtime_error{ "could not create a pipe" };
+  }
+
+  // anything still buffered would otherwise be written by the child as well
+  std::fflush(nullptr);
+
+  auto start = clock::now();
+  pid_t pid  = fork();
+  if (pid < 0) {
+    close(out[0]);
+    close(out[1]);
+    close(base[0]);
+    close(base[1]);
+    throw std::runtime_error{ "could not fork" };
+  }
+  if (pid == 0) {
+    close(out[0]);
+    close(base[0]);
+    run_child(body, input, out[1], base[1]);
+  }
+  close(out[1]);
+  close(base[1]);
+  setpgid(pid, pid);
+
+  sample s;
+  s.out_hash    = fnv_basis;
+  auto deadline = start + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>{ timeout });
+  char buf[1 << 16];
+  for (;;) {
+    auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - clock::now()).count();
+    if (left <= 0) {
+      kill(-pid, SIGKILL);
+      s.status = status_t::timeout;
+      break;
+    }
+
+    pollfd p{ out[0], POLLIN, 0 };
+    if (poll(&p, 1, static_cast<int>(left)) <= 0) continue;
+
+    auto got = read(out[0], buf, sizeof(buf));
+    if (got < 0 && errno == EINTR) continue;
+    if (got <= 0) break; // the child is done writing
+
+    for (ssize_t i = 0; i < got; ++i) {
+      s.out_hash = (s.out_hash ^ static_cast<std::uint8_t>(buf[i])) * fnv_prime;
+    }
+    s.out_bytes += static_cast<std::uint64_t>(got);
+  }
+  close(out[0]);
+
+  int    status = 0;
+  rusage usage{ };
+  while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) { }
+  s.wall = std::chrono::duration<double>{ clock::now() - start }.count();
+
+  if (s.status != status_t::timeout) {
+    s.status = WIFEXITED(status) && WEXITSTATUS(status) == 0 ? status_t::ok : status_t::fault;
+  }
+  // a forked child starts out with the harness's pages resident, and on
+  // linux an exec keeps the high-water mark from before it. so every run,
+  // in process or exec'd, is measured from what it inherited
+  long inherited = 0;
+  if (read(base[0], &inherited, sizeof(inherited)) != sizeof(inherited)) inherited = 0;
+  close(base[0]);
+  s.peak_kb = std::max(0L, max_rss_kb(usage) - inherited);
+  return s;
+}
+
+int shell(const std::string& command) {
+  std::fflush(nullptr);
+  int status = std::system((command + " >/dev/null 2>&1").c_str());
+  return status != -1 && WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+} // namespace bench
+
+} // namespace bf
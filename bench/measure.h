@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+
+#include <functional>
+#include <string>
+
+namespace bf {
+
+namespace bench {
+
+enum class status_t {
+  ok,      // exited with 0
+  fault,   // exited non-zero or was killed by a signal
+  timeout, // still running when its time ran out
+  error    // the backend could not build the program
+};
+
+const char* to_string(status_t status);
+
+// one run of a program as seen from outside the process that ran it
+struct sample {
+  status_t      status    = status_t::ok;
+  double        wall      = 0; // seconds from fork to exit
+  long          peak_kb   = 0; // largest resident set of the child above what it inherited
+  std::uint64_t out_bytes = 0;
+  std::uint64_t out_hash  = 0; // fnv-1a of everything written to stdout
+};
+
+// runs body in a forked child with stdin read from input (nothing when
+// empty) and stdout captured, the child exits with what body returns. its
+// peak is counted from the resident set it had right after the fork. the
+// child and anything it starts are killed once timeout seconds have passed.
+// throws std::runtime_error if the child cannot be started
+sample measure(const std::function<int()>& body, const std::string& input, double timeout);
+
+// runs command through the shell with its output thrown away, returns its
+// exit status
+int shell(const std::string& command);
+
+} // namespace bench
+
+} // namespace bf
@@ -0,0 +1,95 @@
+#include <bench/report.h>
+
+#include <iomanip>
+
+namespace bf {
+
+namespace bench {
+
+namespace {
+
+bool has_rate(const row& r) {
+  return r.ops != 0 && r.run.status == status_t::ok && r.run.wall > 0;
+}
+
+double rate(const row& r) {
+  return static_cast<double>(r.ops) / r.run.wall;
+}
+
+// program paths are the only free text we write
+void csv_string(std::ostream& os, const std::string& s) {
+  if (s.find_first_of(",\"\n") == std::string::npos) {
+    os << s;
+    return;
+  }
+  os << '"';
+  for (char c : s) {
+    if (c == '"') os << '"';
+    os << c;
+  }
+  os << '"';
+}
+
+void json_string(std::ostream& os, const std::string& s) {
+  static const char hex[] = "0123456789abcdef";
+  os << '"';
+  for (char c : s) {
+    auto u = static_cast<unsigned char>(c);
+    if (c == '"' || c == '\\') os << '\\' << c;
+    else if (u < 0x20)         os << "\\u00" << hex[u >> 4] << hex[u & 0xf];
+    else                       os << c;
+  }
+  os << '"';
+}
+
+} // namespace
+
+void write_csv(std::ostream& os, const std::vector<row>& rows) {
+  os << "program,backend,level,status,wall_ms,ops,ops_per_sec,peak_kb,output_bytes,output\n";
+  os << std::fixed;
+  for (const auto& r : rows) {
+    csv_string(os, r.program);
+    os << ',' << r.backend
+       << ',' << r.level
+       << ',' << to_string(r.run.status)
+       << ',' << std::setprecision(3) << r.run.wall * 1000
+       << ',';
+    if (r.ops != 0)  os << r.ops;
+    os << ',';
+    if (has_rate(r)) os << std::setprecision(0) << rate(r);
+    os << ',' << r.run.peak_kb
+       << ',' << r.run.out_bytes
+       << ',' << r.output << '\n';
+  }
+}
+
+void write_json(std::ostream& os, const std::vector<row>& rows) {
+  os << "[";
+  os << std::fixed;
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    const auto& r = rows[i];
+    os << (i == 0 ? "\n" : ",\n") << "  { \"program\": ";
+    json_string(os, r.program);
+    os << ", \"backend\": \"" << r.backend << '"'
+       << ", \"level\": \"" << r.level << '"'
+       << ", \"status\": \"" << to_string(r.run.status) << '"'
+       << ", \"wall_ms\": " << std::setprecision(3) << r.run.wall * 1000
+       << ", \"ops\": ";
+    if (r.ops != 0)  os << r.ops;
+    else             os << "null";
+    os << ", \"ops_per_sec\": ";
+    if (has_rate(r)) os << std::setprecision(0) << rate(r);
+    else             os << "null";
+    os << ", \"peak_kb\": " << r.run.peak_kb
+       << ", \"output_bytes\": " << r.run.out_bytes
+       << ", \"output\": ";
+    if (*r.output) os << '"' << r.output << '"';
+    else           os << "null";
+    os << " }";
+  }
+  os << (rows.empty() ? "]\n" : "\n]\n");
+}
+
+} // namespace bench
+
+} // namespace bf
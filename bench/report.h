@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <bench/measure.h>
+
+namespace bf {
+
+namespace bench {
+
+// a program run through one backend at one optimization level
+struct row {
+  std::string   program;
+  std::string   backend;
+  std::string   level;
+  sample        run;
+  std::uint64_t ops    = 0;  // ir instructions the level executes, 0 when unknown
+  const char*   output = ""; // "match" or "differ" from the least optimized interpreter run, empty when there is nothing to compare
+};
+
+// one line per row after a header. ops/sec is left empty when either the ops
+// or the run are missing
+void write_csv(std::ostream& os, const std::vector<row>& rows);
+// an array with one object per row, missing numbers are null
+void write_json(std::ostream& os, const std::vector<row>& rows);
+
+} // namespace bench
+
+} // namespace bf
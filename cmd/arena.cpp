@@ -0,0 +1,51 @@
+#include <cmd/arena.h>
+
+#include <cstdint>
+
+namespace bf {
+
+namespace cmd {
+
+arena::arena(arena&& mv):
+  blocks_{ std::move(mv.blocks_) },
+  cur_{ mv.cur_ },
+  left_{ mv.left_ } {
+  mv.cur_  = nullptr;
+  mv.left_ = 0;
+}
+
+arena& arena::operator=(arena&& mv) {
+  blocks_  = std::move(mv.blocks_);
+  cur_     = mv.cur_;
+  left_    = mv.left_;
+  mv.cur_  = nullptr;
+  mv.left_ = 0;
+  return *this;
+}
+
+void* arena::allocate_(std::size_t size, std::size_t align) {
+  auto pad = (align - reinterpret_cast<std::uintptr_t>(cur_) % align) % align;
+  if (pad + size > left_) {
+    if (size + align > block_size / 4) {
+      // large requests get a block of their own so they don't waste the rest
+      // of the current one
+      void*       p     = nullptr;
+      std::size_t space = size + align;
+      blocks_.emplace_back(new unsigned char[space]);
+      p = blocks_.back().get();
+      return std::align(align, size, p, space);
+    }
+    blocks_.emplace_back(new unsigned char[block_size]);
+    cur_  = blocks_.back().get();
+    left_ = block_size;
+    pad   = (align - reinterpret_cast<std::uintptr_t>(cur_) % align) % align;
+  }
+  auto p = cur_ + pad;
+  cur_   = p + size;
+  left_ -= pad + size;
+  return p;
+}
+
+} // namespace cmd
+
+} // namespace bf
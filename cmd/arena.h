@@ -0,0 +1,68 @@
+#pragma once
+#include <cstddef>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bf {
+
+namespace cmd {
+
+// a read-only view of a contiguous run of T
+template <typename T>
+class span {
+  const T*    first_;
+  std::size_t size_;
+public:
+  span() : first_{ nullptr }, size_{ 0 } { }
+  span(const T* first, std::size_t size) : first_{ first }, size_{ size } { }
+
+  const T*    begin() const { return first_; }
+  const T*    end()   const { return first_ + size_; }
+  std::size_t size()  const { return size_; }
+  bool        empty() const { return size_ == 0; }
+
+  const T& operator[](std::size_t i) const { return first_[i]; }
+};
+
+// bump allocator that owns the nodes of a program. nothing is freed on its
+// own, every block goes at once when the arena is destroyed, so only trivially
+// destructible types may be placed in it
+class arena {
+  std::vector<std::unique_ptr<unsigned char[]>> blocks_;
+  unsigned char*                                cur_;
+  std::size_t                                   left_;
+
+  void* allocate_(std::size_t size, std::size_t align);
+public:
+  static constexpr std::size_t block_size = 1u << 20;
+
+  arena() : cur_{ nullptr }, left_{ 0 } { }
+  arena(arena&& mv);
+  arena& operator=(arena&& mv);
+
+  arena(const arena&)            = delete;
+  arena& operator=(const arena&) = delete;
+
+  template <typename T, typename... Args>
+  T* make(Args&&... args) {
+    static_assert(std::is_trivially_destructible<T>::value, "the arena never runs destructors");
+    return new (allocate_(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  template <typename T>
+  span<T> copy(const T* first, std::size_t n) {
+    static_assert(std::is_trivially_copyable<T>::value, "the arena never runs destructors");
+    if (n == 0) return { };
+    auto dest = static_cast<T*>(allocate_(sizeof(T) * n, alignof(T)));
+    std::uninitialized_copy(first, first + n, dest);
+    return { dest, n };
+  }
+};
+
+} // namespace cmd
+
+} // namespace bf
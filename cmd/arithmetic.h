@@ -13,8 +13,9 @@ struct arithmetic : command {
     sub
   } type;
   std::uint32_t amount;
+  std::int32_t  offset; // of the cell from p
 
-  arithmetic(arith_type type, std::uint32_t amount = 1u) : type{ type }, amount{ amount } { }
+  arithmetic(arith_type type, std::uint32_t amount = 1u, std::int32_t offset = 0) : type{ type }, amount{ amount }, offset{ offset } { }
 
   void accept(const visitor& visitor) const override { visitor(*this); }
 };
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdint>
+
+#include <cmd/program.h>
+
+namespace bf {
+
+namespace cmd {
+
+// p[offset] = 0, what [-] and [+] boil down to
+struct clear : command {
+  std::int32_t offset;
+
+  clear(std::int32_t offset = 0) : offset{ offset } { }
+
+  void accept(const visitor& visitor) const override { visitor(*this); }
+};
+
+} // namespace cmd
+
+} // namespace bf
@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+
 #include <cmd/program.h>
 
 namespace bf {
@@ -10,8 +12,9 @@ struct io : command {
     in,
     out
   } type;
+  std::int32_t offset; // of the cell from p
 
-  io(io_type type) : type{ type } { }
+  io(io_type type, std::int32_t offset = 0) : type{ type }, offset{ offset } { }
 
   void accept(const visitor& visitor) const override { visitor(*this); }
 };
@@ -6,10 +6,10 @@ namespace bf {
 namespace cmd {
 
 struct loop : command {
-  using cmd_list_t = std::vector<std::shared_ptr<const command>>;
-  cmd_list_t statements;
+  using cmd_list_t = span<const command*>;
+  cmd_list_t statements; // stored in the same arena as the loop
 
-  loop(cmd_list_t statements) : statements{ std::move(statements) } { }
+  loop(cmd_list_t statements) : statements{ statements } { }
 
   void accept(const visitor& visitor) const override { visitor(*this); }
 };
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+#include <cmd/program.h>
+
+namespace bf {
+
+namespace cmd {
+
+// p[offset] += *p * factor, one target of a loop like [->+>++<<]. the loop
+// itself becomes a multiply per target followed by a clear
+struct multiply : command {
+  std::int32_t offset;
+  std::int32_t factor;
+
+  multiply(std::int32_t offset, std::int32_t factor) : offset{ offset }, factor{ factor } { }
+
+  void accept(const visitor& visitor) const override { visitor(*this); }
+};
+
+} // namespace cmd
+
+} // namespace bf
@@ -1,6 +1,9 @@
 #pragma once
+#include <cstddef>
+
 #include <vector>
-#include <memory>
+
+#include <cmd/arena.h>
 
 namespace bf {
 
@@ -9,21 +12,28 @@ namespace cmd {
 struct command {
   struct visitor;
 
-  virtual ~command() { }
-
   virtual void accept(const visitor&) const = 0;
+protected:
+  // commands live in a program's arena and are never destroyed one at a time
+  ~command() = default;
 };
 
 struct arithmetic;
+struct clear;
 struct io;
 struct loop;
+struct multiply;
+struct scan;
 struct shift;
 struct command::visitor {
   virtual ~visitor() { }
 
   virtual void operator()(const arithmetic&) const = 0;
+  virtual void operator()(const clear&)      const = 0;
   virtual void operator()(const io&)         const = 0;
   virtual void operator()(const loop&)       const = 0;
+  virtual void operator()(const multiply&)   const = 0;
+  virtual void operator()(const scan&)       const = 0;
   virtual void operator()(const shift&)      const = 0;
 };
 
@@ -31,11 +41,39 @@ struct command::visitor {
 
 namespace prog {
 
-// a program is composed of a list of commands
-using program = std::vector<std::shared_ptr<const cmd::command>>;
+// a program is composed of a list of commands, all of which are allocated
+// from the program's own arena
+class program {
+  using cmd_list_t = std::vector<const cmd::command*>;
+
+  cmd::arena arena_;
+  cmd_list_t commands_;
+public:
+  using iterator       = cmd_list_t::iterator;
+  using const_iterator = cmd_list_t::const_iterator;
+
+  program() = default;
+  program(program&&) = default;
+  program& operator=(program&&) = default;
+
+  cmd::arena& arena() { return arena_; }
+
+  iterator       begin()       { return std::begin(commands_); }
+  iterator       end()         { return std::end(commands_); }
+  const_iterator begin() const { return std::begin(commands_); }
+  const_iterator end()   const { return std::end(commands_); }
+  const cmd::command* const* data() const { return commands_.data(); }
+  bool        empty() const { return commands_.empty(); }
+  std::size_t size()  const { return commands_.size(); }
+
+  void push_back(const cmd::command* c) { commands_.push_back(c); }
+  // the commands themselves stay in the arena until the program is destroyed
+  void clear() { commands_.clear(); }
+  iterator erase(iterator first, iterator last) { return commands_.erase(first, last); }
+};
 
 inline bool ill_formed(const program& p) { return p.empty(); }
 
 } // namespace prog
 
-} // namespace bf
\ No newline at end of file
+} // namespace bf
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+
+#include <cmd/program.h>
+
+namespace bf {
+
+namespace cmd {
+
+// moves the pointer by stride until it lands on a zero cell, e.g. [>] or [<<]
+struct scan : command {
+  enum class scan_type {
+    left,
+    right
+  } type;
+  std::uint32_t stride;
+
+  scan(scan_type type, std::uint32_t stride = 1u) : type{ type }, stride{ stride } { }
+
+  void accept(const visitor& visitor) const override { visitor(*this); }
+};
+
+} // namespace cmd
+
+} // namespace bf
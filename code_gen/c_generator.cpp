@@ -0,0 +1,184 @@
+#include <code_gen/c_generator.h>
+
+#include <string>
+
+#include <runtime/tape.h>
+
+namespace bf {
+
+namespace code_gen {
+
+// the cell an instruction at offset operates on
+static std::string cell(std::int32_t offset) {
+  return offset == 0 ? "*p" : "p[" + std::to_string(offset) + "]";
+}
+
+c_generator::c_generator(ir::program p, const std::string& outfile):
+  p_{ std::move(p) },
+  file_{ outfile } {
+  if (!file_) throw std::ofstream::failure{ "could not open file for writing" };
+}
+
+void c_generator::emit() {
+  // [>] is a memchr, which libc already vectorizes. other scans are left as
+  // plain loops for the C compiler
+  bool scan_right = false;
+  for (std::size_t i = 0; i != p_.size(); ++i) {
+    scan_right = scan_right || (p_.ops[i] == ir::op_t::scan && p_.args[i] == 1);
+  }
+
+  emit_head_(scan_right);
+  emit_code_(p_);
+  end();
+}
+
+void c_generator::begin() {
+  // there is no telling whether a [>] is coming, so the helper always is
+  emit_head_(true);
+}
+
+void c_generator::emit_part(const ir::program& part) {
+  emit_code_(part);
+}
+
+void c_generator::end() {
+  file_ <<
+R";;(
+  free(tape);
+  return 0;
+);;";
+  if (faults_) {
+    file_ <<
+R";;(
+fault:
+  fflush(stdout);
+  fputs("segmentation fault\n", stderr);
+  free(tape);
+  return 1;
+);;";
+  }
+  file_ << "}\n";
+}
+
+void c_generator::emit_head_(bool scan_right) {
+  file_ <<
+R";;(#include <stdio.h>
+#include <stdlib.h>
+);;";
+  if (scan_right) {
+    file_ <<
+R";;(#include <string.h>
+
+static inline unsigned char* scan_right(unsigned char* p, unsigned char* end) {
+  unsigned char* zero = p < end ? memchr(p, 0, (size_t)(end - p)) : NULL;
+  return zero ? zero : end;
+}
+);;";
+  }
+  file_ <<
+R";;(
+static char out[1 << 16];
+
+int main(void) {
+  unsigned char* tape = calloc();;" << runtime::tape::default_size + 2 * ir::max_offset << R";;(, 1);
+  unsigned char* first;
+  unsigned char* end;
+  unsigned char* p;
+  if (!tape) return 1;
+  /* the pointer stays in [first, end), the offsets on commands may reach max_offset cells past either side */
+  first = tape + );;" << ir::max_offset << R";;(;
+  end   = first + );;" << runtime::tape::default_size << R";;(;
+  p     = first;
+  (void)end;
+  /* output is only written out when the buffer fills, before input is read and at exit */
+  setvbuf(stdout, out, _IOFBF, sizeof out);
+
+);;";
+}
+
+void c_generator::emit_code_(const ir::program& p) {
+  std::size_t indent = 2;
+  auto pad = [&] {
+    for (std::size_t i = 0; i < indent; ++i) file_.put(' ');
+  };
+
+  for (std::size_t i = 0; i != p.size(); ++i) {
+    auto arg = p.args[i];
+    switch (p.ops[i]) {
+      case ir::op_t::add:
+        pad();
+        file_ << cell(p.offsets[i]) << (arg < 0 ? " -= " : " += ") << ((arg < 0 ? -arg : arg) & 0xFF) << ";\n";
+        break;
+      case ir::op_t::shift:
+        move_(arg, indent);
+        break;
+      case ir::op_t::in:
+        pad();
+        file_ << "{ int c; fflush(stdout); c = getchar(); " << cell(p.offsets[i]) << " = c == EOF ? 0 : (unsigned char)c; }\n";
+        break;
+      case ir::op_t::out:
+        pad();
+        file_ << "putchar(" << cell(p.offsets[i]) << ");\n";
+        break;
+      case ir::op_t::jz:
+        pad();
+        file_ << "while (*p) {\n";
+        indent += 2;
+        break;
+      case ir::op_t::jnz:
+        indent -= 2;
+        pad();
+        file_ << "}\n";
+        break;
+      case ir::op_t::clear:
+        pad();
+        file_ << cell(p.offsets[i]) << " = 0;\n";
+        break;
+      case ir::op_t::mul:
+        pad();
+        // the target may be off the tape when the loop this came from never ran
+        file_ << "if (*p) { " << reach_(p.offsets[i]) << "p[" << p.offsets[i] << "] += *p * " << arg << "; }\n";
+        break;
+      case ir::op_t::scan:
+        pad();
+        if (arg == 1) {
+          faults_ = true;
+          file_ << "p = scan_right(p, end);\n";
+          pad();
+          file_ << "if (p == end) goto fault;\n";
+          break;
+        }
+        file_ << "while (*p) {\n";
+        move_(arg, indent + 2);
+        pad();
+        file_ << "}\n";
+        break;
+      case ir::op_t::halt:
+        break; // never produced by the front end
+    }
+  }
+}
+
+// moves p by amount, a move that would leave the tape is a fault
+void c_generator::move_(std::int32_t amount, std::size_t indent) {
+  faults_ = true;
+  auto distance = amount < 0 ? -static_cast<std::int64_t>(amount) : amount;
+  for (std::size_t i = 0; i < indent; ++i) file_.put(' ');
+  file_ << (amount < 0 ? "if (p - first < " : "if (end - p <= ") << distance << ") goto fault;\n";
+  for (std::size_t i = 0; i < indent; ++i) file_.put(' ');
+  file_ << "p " << (amount < 0 ? "-= " : "+= ") << distance << ";\n";
+}
+
+// checks that p[offset] is on the tape, offsets within the margin always are
+std::string c_generator::reach_(std::int32_t offset) {
+  if (offset >= -ir::max_offset && offset <= ir::max_offset) return "";
+  faults_ = true;
+  if (offset < 0) {
+    return "if (p - first < " + std::to_string(-static_cast<std::int64_t>(offset)) + ") goto fault; ";
+  }
+  return "if (end - p <= " + std::to_string(offset) + ") goto fault; ";
+}
+
+} // namespace code_gen
+
+} // namespace bf
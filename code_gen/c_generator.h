@@ -0,0 +1,35 @@
+#pragma once
+#include <fstream>
+#include <string>
+
+#include <code_gen/code_gen.h>
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace code_gen {
+
+// emits a freestanding C program, meant to be built with an optimizing C
+// compiler (e.g. clang -O3 a.c)
+class c_generator : public stream_generator {
+  ir::program   p_;
+  std::ofstream file_;
+  bool          faults_ = false; // some check jumps to the fault label
+
+  void emit_head_(bool scan_right);
+  void emit_code_(const ir::program& p);
+  void move_(std::int32_t amount, std::size_t indent);
+  std::string reach_(std::int32_t offset);
+public:
+  c_generator(ir::program p, const std::string& outfile);
+
+  void emit() override;
+
+  void begin() override;
+  void emit_part(const ir::program& part) override;
+  void end() override;
+};
+
+} // namespace code_gen
+
+} // namespace bf
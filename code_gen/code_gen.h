@@ -1,26 +1,67 @@
 #pragma once
-#include <fstream>
+#include <memory>
+#include <string>
 
 #include <cmd/program.h>
+#include <ir/ir.h>
 
 namespace bf {
 
 namespace code_gen {
 
-class js_generator {
-  prog::program p_;
-  std::ofstream file_;
+enum class target_t {
+  js,
+  c,
+  llvm,
+  wasm
+};
+
+// how the js target lays out the program in the page
+enum class js_layout_t {
+  closures,   // a closure per command, run by a dispatch loop
+  structured, // plain statements and while loops in a generator that yields for input
+  worker      // plain statements and while loops in a web worker that blocks for input
+};
+
+// settings for individual targets, a target ignores the ones that aren't its own
+struct options {
+  js_layout_t js_layout = js_layout_t::closures;
+  unsigned    cell_bits = 8;     // the js tape can also hold 16 or 32 bit cells
+  bool        js_minify = false; // short names and no comments or whitespace in the page's script
+  bool        js_gzip   = false; // also write the page gzipped, next to it with .gz appended
+};
 
-  void emit_css_();
-  void emit_html_();
-  void emit_base_js_();
-  void emit_code_();
+// every backend writes the whole translated program to its output on emit()
+class generator {
 public:
-  js_generator(prog::program p, const std::string& outfile);
+  virtual ~generator() { }
 
-  void emit();
+  virtual void emit() = 0;
 };
 
-}
+// a backend that can also be handed the program a part at a time, as the
+// front end parses it, so that only the part being translated is in memory.
+// emit() is begin(), one emit_part() with the whole program and end()
+class stream_generator : public generator {
+public:
+  // parts are whole top-level statements, in program order
+  virtual void begin() = 0;
+  virtual void emit_part(const ir::program& part) = 0;
+  virtual void end() = 0;
+};
+
+// the conventional output file name for a target when none is given
+const char* default_outfile(target_t target);
+
+// either representation can be handed to any target, it is converted to the
+// one the target translates. throws std::ofstream::failure if outfile cannot
+// be opened
+std::unique_ptr<generator> make_generator(target_t target, prog::program p, const std::string& outfile, const options& opts = options{ });
+std::unique_ptr<generator> make_generator(target_t target, ir::program p, const std::string& outfile, const options& opts = options{ });
+// a generator to stream the program through, nullptr when the target (or the
+// js layout) needs all of it up front
+std::unique_ptr<stream_generator> make_stream_generator(target_t target, const std::string& outfile, const options& opts = options{ });
+
+} // namespace code_gen
 
-}
\ No newline at end of file
+} // namespace bf
@@ -0,0 +1,54 @@
+#include <code_gen/gzip.h>
+
+#include <fstream>
+#include <stdexcept>
+
+#if BF_ZLIB
+#include <zlib.h>
+#endif
+
+namespace bf {
+
+namespace code_gen {
+
+#if BF_ZLIB
+
+bool gzip_supported() {
+  return true;
+}
+
+void gzip_file(const std::string& path) {
+  std::ifstream in{ path, std::ios::binary };
+  if (!in) throw std::ofstream::failure{ "could not open " + path + " for reading" };
+
+  auto gz_path = path + ".gz";
+  auto gz      = gzopen(gz_path.c_str(), "wb9");
+  if (!gz) throw std::ofstream::failure{ "could not open " + gz_path + " for writing" };
+
+  // the page is compressed once and served many times, so at the highest level
+  char chunk[1 << 16];
+  bool ok = true;
+  while (ok && in) {
+    in.read(chunk, sizeof chunk);
+    auto n = static_cast<unsigned>(in.gcount());
+    ok = n == 0 || gzwrite(gz, chunk, n) == static_cast<int>(n);
+  }
+  ok = gzclose(gz) == Z_OK && ok && in.eof();
+  if (!ok) throw std::ofstream::failure{ "could not write " + gz_path };
+}
+
+#else
+
+bool gzip_supported() {
+  return false;
+}
+
+void gzip_file(const std::string&) {
+  throw std::runtime_error{ "built without zlib, so pages cannot be gzipped" };
+}
+
+#endif
+
+} // namespace code_gen
+
+} // namespace bf
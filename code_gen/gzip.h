@@ -0,0 +1,18 @@
+#pragma once
+#include <string>
+
+namespace bf {
+
+namespace code_gen {
+
+// whether this build can gzip, it needs zlib
+bool gzip_supported();
+
+// writes the file at path gzipped to path + ".gz", for static servers that
+// hand out precompressed files as they are. throws std::ofstream::failure if
+// either file cannot be used and std::runtime_error when gzip isn't supported
+void gzip_file(const std::string& path);
+
+} // namespace code_gen
+
+} // namespace bf
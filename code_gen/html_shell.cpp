@@ -0,0 +1,219 @@
+#include <code_gen/html_shell.h>
+
+namespace bf {
+
+namespace code_gen {
+
+void emit_page_head(std::ostream& out) {
+  const char* partial_head =
+R";;(<!DOCTYPE html>
+<html>
+);;";
+  out << partial_head;
+
+  const char* css =
+R";;(<style>
+.input {
+  display: inline-block;
+  width: 49%;
+  height: 500px;
+}
+.output {
+  display: inline-block;
+  width: 49%;
+  height: 500px;
+}
+label {
+  display: block;
+}
+textarea {
+  background-color: black;
+  color: white;
+  border: none;
+  width: 95%;
+  height: 95%;
+}
+</style>
+);;";
+  out << css;
+
+  const char* to_prog =
+R";;(<body>
+<div class='input'>
+<label for='in'>Input (Hit CTRL-C to issue EOF)</label>
+<textarea id='in'></textarea>
+</div>
+
+<div class='output'>
+<label for='out'>Output</label>
+<textarea id='out'></textarea>
+</div>
+
+<script>
+);;";
+  out << to_prog;
+}
+
+void emit_page_runtime(std::ostream& out) {
+  const char* base_js =
+R";;(window.addEventListener('load', function() {
+  var input_text  = document.getElementById('in');
+  var output_text = document.getElementById('out');
+
+  // create input manager with the textarea
+  this.io_mgr = new IO_mgr();
+  this.io_mgr.init(input_text, output_text);
+
+  /*
+  var check_input = function() {
+    var input = io_mgr.poll_char();
+    if (input !== undefined) {
+      var out = document.getElementById('out');
+      out.value += "\nNew value: " + input;
+    }
+    setTimeout(check_input, 500);
+  }
+  check_input();
+  */
+
+  this.prog = new Program();
+  this.prog.init(this.io_mgr);
+  this.prog.exe();
+});
+
+var IO_mgr = function() {
+  var key_id_ = {
+    ENTER: 13,
+    CTRL:  17,
+    C:     67
+  };
+  var input_    = undefined;
+  var output_   = undefined;
+  var lines_    = [];
+  var key_down_ = [];
+  var readers_  = [];
+  var pending_  = []; // output not yet in the textarea
+  var flushing_ = false;
+
+  var self_ = {
+    init: function(input, output) {
+      input_  = input;
+      output_ = output;
+
+      input_.addEventListener('keydown', this.handle_keydown);
+      input_.addEventListener('keyup', this.handle_keyup);
+    },
+    poll_line: function() {
+      if (lines_.length > 0) return lines_.shift();
+      return undefined;
+    },
+    poll_char: function() {
+      if (lines_.length > 0) {
+        if (lines_[0].length > 0) {
+          var c = lines_[0][0];
+          lines_[0] = lines_[0].slice(1, lines_[0].length);
+          return c;
+        }
+        lines_.shift();
+        return '\n';
+      }
+      return undefined;
+    },
+    // resolves with the next character as soon as one is typed
+    read_char: function() {
+      var c = self_.poll_char();
+      if (c !== undefined) return Promise.resolve(c);
+      self_.flush(); // the program waits on the user, show them what it wrote
+      return new Promise(function(resolve) { readers_.push(resolve); });
+    },
+    // output is appended to the textarea at most once a frame, every append
+    // copies everything that is already in there
+    put_char: function(c) {
+      pending_.push(c);
+      if (!flushing_) {
+        flushing_ = true;
+        window.requestAnimationFrame(self_.flush);
+      }
+    },
+    put_line: function(line) {
+      self_.put_char(line + '\n');
+      self_.flush();
+    },
+    flush: function() {
+      flushing_ = false;
+      if (pending_.length > 0) {
+        output_.value += pending_.join('');
+        pending_ = [];
+      }
+    },
+    handle_keydown: function(e) {
+      key_down_[e.keyCode] = true;
+      if (e.keyCode === key_id_.ENTER) {
+        e.preventDefault();
+      }
+    },
+    handle_keyup: function(e) {
+      if (key_down_[key_id_.CTRL] && e.keyCode == key_id_.C) {
+        // add EOF char, ie '\0'
+        lines_.push('\0');
+      }
+      if (e.keyCode === key_id_.ENTER) {
+        lines_.push(input_.value.split('\n').pop());
+        input_.value += '\n';
+      }
+
+      key_down_[e.keyCode] = false;
+
+      while (readers_.length > 0 && lines_.length > 0) {
+        readers_.shift()(self_.poll_char());
+      }
+    }
+  };
+  return self_;
+};
+
+// runs a job in slices so the page can draw and handle input in between.
+// job(budget) does up to budget units of work and returns whether it has
+// more to do. the budget follows how long slices take so each stays around
+// target_ms_, a part of a frame
+var Scheduler = function() {
+  var target_ms_ = 8;
+  var budget_    = 1 << 14;
+  var job_       = undefined;
+  var channel_   = new MessageChannel();
+
+  var slice = function() {
+    var start = performance.now();
+    var more  = job_(budget_);
+    if (!more) return;
+
+    var spent = Math.max(performance.now() - start, 0.1);
+    budget_ = Math.max(1 << 10, Math.floor(budget_ * Math.min(2, target_ms_ / spent)));
+    // unlike setTimeout(0), messages are not throttled to one per 4ms
+    channel_.port2.postMessage(null);
+  };
+  channel_.port1.onmessage = slice;
+
+  return {
+    start: function(job) {
+      job_ = job;
+      channel_.port2.postMessage(null);
+    }
+  };
+};
+);;";
+
+  out << base_js;
+}
+
+void emit_page_tail(std::ostream& out) {
+  const char* end =
+R";;(</script>
+</body>
+</html>);;";
+  out << end;
+}
+
+} // namespace code_gen
+
+} // namespace bf
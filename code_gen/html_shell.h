@@ -0,0 +1,20 @@
+#pragma once
+#include <ostream>
+
+namespace bf {
+
+namespace code_gen {
+
+// the page the browser targets run in: an input and an output textarea and
+// the IO_mgr between them, with a load handler that does
+//   prog = new Program(); prog.init(io_mgr); prog.exe();
+// the head opens a script for a target to define Program in, followed by the
+// runtime, which defines IO_mgr, the load handler and Scheduler, for programs
+// that run in slices. the tail closes the script and the page
+void emit_page_head(std::ostream& out);
+void emit_page_runtime(std::ostream& out);
+void emit_page_tail(std::ostream& out);
+
+} // namespace code_gen
+
+} // namespace bf
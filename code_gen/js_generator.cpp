@@ -0,0 +1,895 @@
+#include <code_gen/js_generator.h>
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// commands
+#include <cmd/arithmetic.h>
+#include <cmd/clear.h>
+#include <cmd/io.h>
+#include <cmd/loop.h>
+#include <cmd/multiply.h>
+#include <cmd/scan.h>
+#include <cmd/shift.h>
+
+#include <code_gen/gzip.h>
+#include <code_gen/html_shell.h>
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace code_gen {
+
+js_generator::js_generator(prog::program p, const std::string& outfile, const options& opts):
+  p_{ std::move(p) },
+  outfile_{ outfile },
+  file_{ outfile },
+  minifier_{ file_.rdbuf() },
+  script_{ opts.js_minify ? static_cast<std::streambuf*>(&minifier_) : file_.rdbuf() },
+  layout_{ opts.js_layout },
+  cell_bits_{ opts.cell_bits },
+  gzip_{ opts.js_gzip } {
+  if (!file_) throw std::ofstream::failure{ "could not open file for writing" };
+}
+
+void js_generator::emit() {
+  begin();
+  switch (layout_) {
+    case js_layout_t::closures:   emit_commands_(p_);      break;
+    case js_layout_t::structured: emit_structured_code_(); break;
+    case js_layout_t::worker:     emit_worker_code_();     break;
+  }
+  end();
+}
+
+// the tape starts this many cells in and is kept at least this many cells
+// longer than the pointer, so the offsets the optimizer puts on commands
+// always land on a cell
+static constexpr std::int32_t tape_margin = ir::max_offset;
+
+// cells the tape starts out with, it doubles from there as needed
+static constexpr std::int32_t initial_tape_size = 1 << 16;
+
+// how each layout gives up on the program when it runs off the tape
+static const char* const closure_fault    = "self_.seg_fault(); return;";
+static const char* const structured_fault = "throw self_.seg_fault();";
+
+// how the structured layout hands control back once its slice is used up
+static const char* const tick = "if (--fuel_ < 0) yield slice_;";
+
+// moves ptr, an index into tape, by amount. running off the start is a
+// fault, running towards the end grows the tape
+static std::string move_js(const std::string& ptr, const std::string& tape, std::int32_t amount, const char* fault = closure_fault) {
+  std::stringstream ss;
+  if (amount < 0) {
+    ss << "if (" << ptr << " + " << amount << " < " << tape_margin << ") { " << fault << " } " <<
+      ptr << " += " << amount << ";";
+  }
+  else {
+    ss << ptr << " += " << amount << "; " <<
+      "if (" << ptr << " + " << tape_margin << " >= " << tape << ".length) { " << tape << " = self_.grow(" << ptr << " + " << tape_margin << "); }";
+  }
+  return ss.str();
+}
+
+// makes tape[ptr + offset] addressable for offsets outside the margin
+static std::string reach_js(const std::string& ptr, const std::string& tape, std::int32_t offset, const char* fault = closure_fault) {
+  std::stringstream ss;
+  if (offset < -tape_margin) {
+    ss << "if (" << ptr << " + " << offset << " < " << tape_margin << ") { " << fault << " } ";
+  }
+  else if (offset > tape_margin) {
+    ss << "if (" << ptr << " + " << offset << " >= " << tape << ".length) { " << tape << " = self_.grow(" << ptr << " + " << offset << "); } ";
+  }
+  return ss.str();
+}
+
+// writes the commands of the closures layout straight to an output, one
+// closure per command. a loop is its check, its body and its jump back, so
+// both jumps need the size of the loop's subtree. those are measured in one
+// pass before anything is written and handed out again in the same order
+class closure_writer {
+  std::vector<std::size_t> sizes_; // of every loop in program order
+  std::size_t              next_ = 0;
+  std::ostream*            out_;
+  bool                     first_ = true;
+
+  std::size_t measure_(const cmd::command& c);
+  void write_command_(const cmd::command& c);
+public:
+  // first is whether nothing was written to out before
+  explicit closure_writer(std::ostream& out, bool first = true) : out_{ &out }, first_{ first } { }
+
+  // writes [first, last) as a comma separated list of closures
+  void write(const cmd::command* const* first, const cmd::command* const* last);
+};
+
+std::size_t closure_writer::measure_(const cmd::command& c) {
+  struct measure_visitor : cmd::command::visitor {
+    closure_writer* w;
+    std::size_t*    size;
+    measure_visitor(closure_writer& w, std::size_t& size) : w{ &w }, size{ &size } { }
+
+    void operator()(const cmd::arithmetic&) const override { *size = 1; }
+    void operator()(const cmd::clear&)      const override { *size = 1; }
+    void operator()(const cmd::io&)         const override { *size = 1; }
+    void operator()(const cmd::multiply&)   const override { *size = 1; }
+    void operator()(const cmd::scan&)       const override { *size = 1; }
+    void operator()(const cmd::shift&)      const override { *size = 1; }
+    void operator()(const cmd::loop& l)     const override {
+      // the slot is taken before the body's so the order matches writing
+      auto slot = w->sizes_.size();
+      w->sizes_.push_back(0);
+      *size = 2; // the check and the jump
+      for (const auto& stmt : l.statements) {
+        *size += w->measure_(*stmt);
+      }
+      w->sizes_[slot] = *size;
+    }
+  };
+  std::size_t size;
+  measure_visitor mv{ *this, size };
+  c.accept(mv);
+  return size;
+}
+
+void closure_writer::write(const cmd::command* const* first, const cmd::command* const* last) {
+  sizes_.clear();
+  next_ = 0;
+  for (auto it = first; it != last; ++it) {
+    measure_(**it);
+  }
+  for (auto it = first; it != last; ++it) {
+    write_command_(**it);
+  }
+}
+
+void closure_writer::write_command_(const cmd::command& c) {
+  struct js_generate_visitor : cmd::command::visitor {
+    closure_writer* w;
+    js_generate_visitor(closure_writer& w) : w{ &w } { }
+
+    // every closure but the first is preceded by a comma
+    std::ostream& item() const {
+      if (!w->first_) w->out_->put(',');
+      w->first_ = false;
+      return *w->out_;
+    }
+
+    void operator()(const cmd::arithmetic& a) const override {
+      auto amount = (a.type == cmd::arithmetic::arith_type::add? static_cast<std::int32_t>(a.amount) : -static_cast<std::int32_t>(a.amount));
+      if (a.offset == 0) {
+        item() <<
+          "function() { value_arr_[cur_] += " << amount << "; SP_ += 1; }";
+      }
+      else {
+        item() <<
+          "function() { value_arr_[cur_ + " << a.offset << "] += " << amount << "; SP_ += 1; }";
+      }
+    }
+    void operator()(const cmd::clear& c) const override {
+      if (c.offset == 0) {
+        item() <<
+          "function() { value_arr_[cur_] = 0; SP_ += 1; }";
+      }
+      else {
+        item() <<
+          "function() { value_arr_[cur_ + " << c.offset << "] = 0; SP_ += 1; }";
+      }
+    }
+    void operator()(const cmd::multiply& m) const override {
+      item() <<
+        "function() { if (value_arr_[cur_] !== 0) { " << reach_js("cur_", "value_arr_", m.offset) <<
+        "value_arr_[cur_ + " << m.offset << "] += Math.imul(value_arr_[cur_], " << m.factor << "); } " <<
+        "SP_ += 1; }";
+    }
+    void operator()(const cmd::scan& s) const override {
+      auto stride = (s.type == cmd::scan::scan_type::right ? static_cast<std::int32_t>(s.stride) : -static_cast<std::int32_t>(s.stride));
+      item() <<
+        "function() { while (value_arr_[cur_] !== 0) { " << move_js("cur_", "value_arr_", stride) << " } " <<
+        "SP_ += 1; }";
+    }
+    void operator()(const cmd::io& io) const override {
+      auto fn = (io.type == cmd::io::io_type::in ? "self_.get_char" : "self_.put_char");
+      if (io.offset == 0) {
+        item() << fn;
+      }
+      else {
+        item() << "function() { " << fn << "(" << io.offset << "); }";
+      }
+    }
+    void operator()(const cmd::shift& s) const override {
+      auto amount = (s.type == cmd::shift::shift_type::right ? static_cast<std::int32_t>(s.amount) : -static_cast<std::int32_t>(s.amount));
+      item() <<
+        "function() { " << move_js("cur_", "value_arr_", amount) << " " <<
+        "SP_ += 1; }";
+    }
+    void operator()(const cmd::loop& l) const override {
+      auto size = w->sizes_[w->next_++];
+
+      // condition
+      item() << "function() { if (value_arr_[cur_] === 0) { " <<
+        "SP_ += " << size << "; }" <<
+        "else { SP_ += 1; } }";
+
+      // body
+      for (const auto& stmt : l.statements) {
+        w->write_command_(*stmt);
+      }
+
+      // jump
+      item() << "function() { SP_ -= " << size - 1 << "; }";
+    }
+  } gen_visitor{ *this };
+  c.accept(gen_visitor);
+}
+
+// writes the program for the structured layout, where p is the pointer and
+// tape the cells. engines stop optimizing a function past a certain size, so
+// loops and runs of statements too large for that are hoisted into functions
+// of their own that take and return p. those that read input are generators
+// and are called through yield*. so are those with loops that tick, which
+// yield when the program's time slice runs out. a loop ticks on every
+// iteration unless it is known to end on its own within 256 of them, any
+// other may walk the tape, wait for a wide cell to wrap or never end. a
+// blocking writer is for code that can wait on input where it stands, it is
+// written as plain functions that never yield
+class structured_writer {
+  // statements a function may hold before the rest is hoisted out of it
+  static constexpr std::size_t max_function_size = 300;
+
+  struct size_info {
+    std::size_t size;   // commands in the subtree
+    bool        yields; // whether the subtree reads or ticks
+  };
+  std::unordered_map<const cmd::command*, size_info> loops_;
+  std::stringstream functions_;
+  std::size_t       next_function_ = 0;
+  unsigned          cell_bits_;
+  bool              blocking_;
+
+  size_info measure_(const cmd::command& c);
+  bool ticks_(const cmd::loop& l) const;
+  bool yields_(const cmd::command* const* first, const cmd::command* const* last);
+  std::size_t weight_(const cmd::command& c);
+  std::string hoist_(const cmd::command* const* first, const cmd::command* const* last);
+  void write_command_(const cmd::command& c, std::ostream& out, std::size_t indent);
+public:
+  explicit structured_writer(unsigned cell_bits, bool blocking = false) : cell_bits_{ cell_bits }, blocking_{ blocking } { }
+
+  // writes [first, last) to out, hoisting whatever makes it too large
+  void write(const cmd::command* const* first, const cmd::command* const* last, std::ostream& out, std::size_t indent);
+
+  // the hoisted functions, in no particular order
+  std::string functions() const { return functions_.str(); }
+};
+
+structured_writer::size_info structured_writer::measure_(const cmd::command& c) {
+  struct measure_visitor : cmd::command::visitor {
+    structured_writer* w;
+    size_info*         info;
+    measure_visitor(structured_writer& w, size_info& info) : w{ &w }, info{ &info } { }
+
+    void operator()(const cmd::arithmetic&) const override { *info = { 1, false }; }
+    void operator()(const cmd::clear&)      const override { *info = { 1, false }; }
+    void operator()(const cmd::io& io)      const override { *info = { 1, !w->blocking_ && io.type == cmd::io::io_type::in }; }
+    void operator()(const cmd::multiply&)   const override { *info = { 1, false }; }
+    void operator()(const cmd::scan&)       const override { *info = { 1, false }; }
+    void operator()(const cmd::shift&)      const override { *info = { 1, false }; }
+    void operator()(const cmd::loop& l)     const override {
+      *info = { 1, w->ticks_(l) };
+      for (const auto& stmt : l.statements) {
+        auto stmt_info = w->measure_(*stmt);
+        info->size   += stmt_info.size;
+        info->yields  = info->yields || stmt_info.yields;
+      }
+      w->loops_[&l] = *info;
+    }
+  };
+  size_info info;
+  measure_visitor mv{ *this, info };
+  c.accept(mv);
+  return info;
+}
+
+// whether l needs a tick. a loop that leaves the pointer where it is and only
+// adds an odd amount to its own 8 bit cell steps that cell through all 256
+// values, so it ends within 256 iterations
+bool structured_writer::ticks_(const cmd::loop& l) const {
+  struct bounded_visitor : cmd::command::visitor {
+    bool*          bounded;
+    std::uint32_t* step;
+    bounded_visitor(bool& bounded, std::uint32_t& step) : bounded{ &bounded }, step{ &step } { }
+
+    void operator()(const cmd::arithmetic& a) const override {
+      if (a.offset == 0) *step += a.type == cmd::arithmetic::arith_type::add ? a.amount : 0u - a.amount;
+    }
+    void operator()(const cmd::clear& c)    const override { *bounded = *bounded && c.offset != 0; }
+    void operator()(const cmd::io& io)      const override { *bounded = *bounded && (io.type == cmd::io::io_type::out || io.offset != 0); }
+    void operator()(const cmd::multiply& m) const override { *bounded = *bounded && m.offset != 0; }
+    void operator()(const cmd::scan&)       const override { *bounded = false; }
+    void operator()(const cmd::shift&)      const override { *bounded = false; }
+    void operator()(const cmd::loop&)       const override { *bounded = false; }
+  };
+  if (blocking_) return false;
+  if (cell_bits_ != 8) return true;
+
+  bool          bounded = true;
+  std::uint32_t step    = 0;
+  bounded_visitor bv{ bounded, step };
+  for (const auto& stmt : l.statements) {
+    stmt->accept(bv);
+  }
+  return !bounded || step % 2 == 0;
+}
+
+// how much of its function c takes up, loops too large to inline only leave
+// a call behind
+std::size_t structured_writer::weight_(const cmd::command& c) {
+  auto it = loops_.find(&c);
+  if (it == std::end(loops_)) return 1;
+  return it->second.size > max_function_size ? 1 : it->second.size;
+}
+
+bool structured_writer::yields_(const cmd::command* const* first, const cmd::command* const* last) {
+  bool yields = false;
+  for (auto it = first; it != last; ++it) {
+    auto info = loops_.find(*it);
+    yields = yields || (info != std::end(loops_) ? info->second.yields : measure_(**it).yields);
+  }
+  return yields;
+}
+
+std::string structured_writer::hoist_(const cmd::command* const* first, const cmd::command* const* last) {
+  auto yields = yields_(first, last);
+
+  auto name = "f" + std::to_string(next_function_++);
+  std::stringstream fn;
+  fn << "  function" << (yields ? "* " : " ") << name << "(p) {\n";
+  write(first, last, fn, 4);
+  fn << "    return p;\n"
+     << "  }\n";
+  functions_ << fn.str();
+  return std::string{ "p = " } + (yields ? "yield* " : "") + name + "(p);";
+}
+
+void structured_writer::write(const cmd::command* const* first, const cmd::command* const* last, std::ostream& out, std::size_t indent) {
+  for (auto it = first; it != last; ++it) {
+    if (loops_.find(*it) == std::end(loops_)) measure_(**it);
+  }
+
+  // split into runs that each fit in a function
+  std::vector<const cmd::command* const*> cuts{ first };
+  std::size_t size = 0;
+  for (auto it = first; it != last; ++it) {
+    auto w = weight_(**it);
+    if (size != 0 && size + w > max_function_size) {
+      cuts.push_back(it);
+      size = 0;
+    }
+    size += w;
+  }
+  cuts.push_back(last);
+
+  if (cuts.size() == 2) {
+    for (auto it = first; it != last; ++it) {
+      write_command_(**it, out, indent);
+    }
+    return;
+  }
+  for (std::size_t i = 0; i + 1 < cuts.size(); ++i) {
+    for (std::size_t j = 0; j < indent; ++j) out.put(' ');
+    out << hoist_(cuts[i], cuts[i + 1]) << '\n';
+  }
+}
+
+void structured_writer::write_command_(const cmd::command& c, std::ostream& out, std::size_t indent) {
+  struct js_structured_visitor : cmd::command::visitor {
+    structured_writer* w;
+    std::ostream*      out;
+    std::size_t        indent;
+    js_structured_visitor(structured_writer& w, std::ostream& out, std::size_t indent) : w{ &w }, out{ &out }, indent{ indent } { }
+
+    std::ostream& line() const {
+      for (std::size_t i = 0; i < indent; ++i) out->put(' ');
+      return *out;
+    }
+    static std::string cell(std::int32_t offset) {
+      return offset == 0 ? "tape[p]" : "tape[p + " + std::to_string(offset) + "]";
+    }
+
+    void operator()(const cmd::arithmetic& a) const override {
+      auto amount = (a.type == cmd::arithmetic::arith_type::add? static_cast<std::int32_t>(a.amount) : -static_cast<std::int32_t>(a.amount));
+      line() << cell(a.offset) << " += " << amount << ";\n";
+    }
+    void operator()(const cmd::clear& c) const override {
+      line() << cell(c.offset) << " = 0;\n";
+    }
+    void operator()(const cmd::multiply& m) const override {
+      line() << "if (tape[p] !== 0) {\n";
+      auto reach = reach_js("p", "tape", m.offset, structured_fault);
+      if (!reach.empty()) {
+        line() << "  " << reach << "\n";
+      }
+      line() << "  " << cell(m.offset) << " += Math.imul(tape[p], " << m.factor << ");\n";
+      line() << "}\n";
+    }
+    void operator()(const cmd::scan& s) const override {
+      auto stride = (s.type == cmd::scan::scan_type::right ? static_cast<std::int32_t>(s.stride) : -static_cast<std::int32_t>(s.stride));
+      line() << "while (tape[p] !== 0) { " << move_js("p", "tape", stride, structured_fault) << " }\n";
+    }
+    void operator()(const cmd::io& io) const override {
+      if (io.type == cmd::io::io_type::in && w->blocking_) {
+        line() << cell(io.offset) << " = get_char();\n";
+      }
+      else if (io.type == cmd::io::io_type::in) {
+        // the runtime resumes us with the character once there is one
+        line() << cell(io.offset) << " = yield;\n";
+      }
+      else if (w->blocking_) {
+        line() << "put_char(" << cell(io.offset) << ");\n";
+      }
+      else {
+        line() << "io_mgr_.put_char(String.fromCharCode(" << cell(io.offset) << "));\n";
+      }
+    }
+    void operator()(const cmd::shift& s) const override {
+      line() << move_js("p", "tape", s.type == cmd::shift::shift_type::right ? static_cast<std::int32_t>(s.amount) : -static_cast<std::int32_t>(s.amount), structured_fault) << '\n';
+    }
+    void operator()(const cmd::loop& l) const override {
+      auto first = l.statements.begin();
+      auto last  = l.statements.end();
+      auto ticks = w->ticks_(l);
+      if (ticks && !w->yields_(first, last)) {
+        // nothing in the body yields, so the loop runs on a local copy of the
+        // fuel and only the code around it can suspend. engines keep a loop
+        // like that as tight as one that never ticks
+        line() << "for (;;) {\n";
+        line() << "  var fuel = fuel_;\n";
+        if (w->weight_(l) == 1) {
+          line() << "  while (tape[p] !== 0 && --fuel >= 0) { " << w->hoist_(first, last) << " }\n";
+        }
+        else {
+          line() << "  while (tape[p] !== 0 && --fuel >= 0) {\n";
+          w->write(first, last, *out, indent + 4);
+          line() << "  }\n";
+        }
+        line() << "  fuel_ = fuel;\n";
+        line() << "  if (tape[p] === 0) break;\n";
+        line() << "  yield slice_;\n";
+        line() << "}\n";
+        return;
+      }
+      if (w->weight_(l) == 1) {
+        line() << "while (tape[p] !== 0) { " << w->hoist_(first, last) << (ticks ? " " : "") << (ticks ? tick : "") << " }\n";
+        return;
+      }
+      line() << "while (tape[p] !== 0) {\n";
+      w->write(first, last, *out, indent + 2);
+      if (ticks) line() << "  " << tick << "\n";
+      line() << "}\n";
+    }
+  } gen_visitor{ *this, out, indent };
+  c.accept(gen_visitor);
+}
+
+const char* js_generator::cell_type_() const {
+  switch (cell_bits_) {
+    case 16: return "Uint16Array";
+    case 32: return "Uint32Array";
+    default: return "Uint8Array";
+  }
+}
+
+void js_generator::emit_grow_(std::size_t indent) {
+  std::stringstream grow;
+  grow <<
+R";;(// doubles the tape until index at is on it
+grow: function(at) {
+  var size = value_arr_.length;
+  while (size <= at) size *= 2;
+  var cells = new );;" << cell_type_() << R";;((size);
+  cells.set(value_arr_);
+  value_arr_ = cells;
+  return cells;
+},
+);;";
+  std::string line;
+  while (std::getline(grow, line)) {
+    script_ << std::string(indent, ' ') << line << '\n';
+  }
+}
+
+void js_generator::emit_code_head_() {
+  script_ <<
+R";;(var Program = function() {
+  self_      = undefined;
+  io_mgr_    = undefined;
+  commands_  = [];
+  SP_        = 0;
+  SP_save_   = 0;
+  value_arr_ = undefined;
+  cur_       = );;" << tape_margin << R";;(;
+  scheduler_ = new Scheduler();
+
+  return {
+    init: function(io_mgr) {
+      self_ = this;
+
+      value_arr_ = new );;" << cell_type_() << "(" << initial_tape_size << R";;();
+
+      io_mgr_   = io_mgr;
+      commands_ = [);;";
+}
+
+void js_generator::emit_commands_(const prog::program& p) {
+  closure_writer writer{ script_, !commands_ };
+  writer.write(p.data(), p.data() + p.size());
+  commands_ = commands_ || !p.empty();
+}
+
+void js_generator::emit_code_tail_() {
+  script_ <<
+R";;(];
+    },
+);;";
+  emit_grow_();
+
+  const char* rest =
+R";;(    get_char: function(offset) {
+      offset = offset || 0;
+      var input = io_mgr_.poll_char();
+      if (input !== undefined) {
+        value_arr_[cur_ + offset] = input.charCodeAt(0);
+        SP_ = SP_save_ + 1;
+      }
+      else {
+        // stop here and pick up from this command once there is input
+        var resume_at = SP_save_;
+        SP_ = commands_.length;
+        io_mgr_.read_char().then(function(input) {
+          value_arr_[cur_ + offset] = input.charCodeAt(0);
+          SP_ = resume_at + 1;
+          scheduler_.start(self_.process_command);
+        });
+      }
+    },
+    put_char: function(offset) {
+      io_mgr_.put_char(String.fromCharCode(value_arr_[cur_ + (offset || 0)]));
+      SP_ += 1;
+    },
+    seg_fault: function() {
+      io_mgr_.put_line('segmentation fault');
+      SP_ = commands_.length;
+    },
+    // runs up to budget commands, returns whether the program has more
+    process_command: function(budget) {
+      while (SP_ < commands_.length) {
+        if (budget-- === 0) return true;
+        var cmd = commands_[SP_];
+        SP_save_ = SP_;
+        cmd.apply(self_);
+      }
+      io_mgr_.flush();
+      return false;
+    },
+    exe: function() {
+      scheduler_.start(self_.process_command);
+    }
+  };
+};
+);;";
+  script_ << rest;
+}
+
+void js_generator::emit_structured_code_() {
+  script_ <<
+R";;(var Program = function() {
+  self_      = undefined;
+  io_mgr_    = undefined;
+  value_arr_ = undefined;
+  run_       = undefined;
+  halt_      = {};
+  slice_     = {};
+  scheduler_ = new Scheduler();
+
+  var tape   = undefined;
+  var fuel_  = 0;
+  var input_ = undefined;
+
+  // the whole program, suspended at every read until a character comes in
+  // and whenever it has used up its fuel
+  var body = function*() {
+    var p = );;" << tape_margin << R";;(;
+
+);;";
+
+  structured_writer writer{ cell_bits_ };
+  writer.write(p_.data(), p_.data() + p_.size(), script_, 4);
+
+  script_ <<
+R";;(  };
+
+);;";
+  script_ << writer.functions();
+  script_ <<
+R";;(
+  return {
+    init: function(io_mgr) {
+      self_ = this;
+
+      value_arr_ = tape = new );;" << cell_type_() << "(" << initial_tape_size << R";;();
+
+      io_mgr_ = io_mgr;
+      run_    = body();
+    },
+);;";
+  emit_grow_();
+
+  const char* rest =
+R";;(    // thrown by the program to unwind out of every function it is in
+    seg_fault: function() {
+      io_mgr_.put_line('segmentation fault');
+      return halt_;
+    },
+    // runs up to budget loop iterations, returns whether the program has
+    // more to do. it stops early when it waits on input nobody has typed yet
+    resume: function(budget) {
+      fuel_ = budget;
+      try {
+        var state = run_.next(input_);
+        input_ = undefined;
+        while (!state.done) {
+          if (state.value === slice_) return true;
+          var input = io_mgr_.poll_char();
+          if (input === undefined) {
+            io_mgr_.read_char().then(function(c) {
+              input_ = c.charCodeAt(0);
+              scheduler_.start(self_.resume);
+            });
+            return false;
+          }
+          state = run_.next(input.charCodeAt(0));
+        }
+      }
+      catch (e) {
+        if (e !== halt_) throw e;
+      }
+      io_mgr_.flush();
+      return false;
+    },
+    exe: function() {
+      scheduler_.start(self_.resume);
+    }
+  };
+};
+);;";
+  script_ << rest;
+}
+
+// the worker layout's shared memory: control words, then the ring the page
+// writes input to and the ring the program writes output to. each ring is
+// read and written through indices that only ever go up, wrapping at 2^32
+static constexpr std::int32_t ring_size     = 1 << 16;
+static constexpr std::int32_t control_bytes = 32;
+
+// names for the control words, for both sides of the rings
+static std::string ring_js(std::size_t indent) {
+  const char* const names[] = {
+    "var in_read     = 0;",
+    "var in_written  = 1;",
+    "var out_read    = 2;",
+    "var out_written = 3;",
+    "var want_space  = 4; // the page waits for room in the input ring"
+  };
+  std::string js;
+  for (auto name : names) {
+    js += std::string(indent, ' ') + name + '\n';
+  }
+  return js;
+}
+
+void js_generator::emit_worker_code_() {
+  script_ <<
+R";;(var Program = function() {
+  var self_    = undefined;
+  var io_mgr_  = undefined;
+  var control_ = undefined;
+  var input_   = undefined;
+  var output_  = undefined;
+  var running_ = false;
+  var pending_ = undefined; // typed while the input ring was full
+
+);;" << ring_js(2) << R";;(
+  // runs in the worker, which is started from the source of this function
+  // and so sees nothing else in this script
+  var worker_main = function() {
+    var control    = undefined;
+    var input      = undefined;
+    var output     = undefined;
+    var value_arr_ = undefined;
+    var tape       = undefined;
+    var halt_      = {};
+
+);;" << ring_js(4) << R";;(
+    // blocks until the page hands over a character
+    var get_char = function() {
+      var read = control[in_read];
+      while (Atomics.load(control, in_written) === read) {
+        Atomics.wait(control, in_written, read);
+      }
+      var c = input[read & );;" << ring_size - 1 << R";;(];
+      Atomics.store(control, in_read, (read + 1) | 0);
+      if (Atomics.exchange(control, want_space, 0) === 1) postMessage('space');
+      return c;
+    };
+    // blocks while the page has yet to take what fills the ring
+    var put_char = function(c) {
+      var written = control[out_written];
+      var read    = Atomics.load(control, out_read);
+      while (((written - read) | 0) === );;" << ring_size << R";;() {
+        Atomics.wait(control, out_read, read);
+        read = Atomics.load(control, out_read);
+      }
+      output[written & );;" << ring_size - 1 << R";;(] = c;
+      Atomics.store(control, out_written, (written + 1) | 0);
+    };
+
+    var self_ = {
+);;";
+  emit_grow_(6);
+  script_ <<
+R";;(      seg_fault: function() {
+        return halt_;
+      }
+    };
+
+    var body = function() {
+      var p = );;" << tape_margin << R";;(;
+
+);;";
+
+  structured_writer writer{ cell_bits_, true };
+  writer.write(p_.data(), p_.data() + p_.size(), script_, 6);
+
+  script_ <<
+R";;(    };
+
+);;";
+  script_ << writer.functions();
+  script_ <<
+R";;(
+    onmessage = function(e) {
+      control = new Int32Array(e.data, 0, );;" << control_bytes / 4 << R";;();
+      input   = new Uint16Array(e.data, );;" << control_bytes << ", " << ring_size << R";;();
+      output  = new Uint16Array(e.data, );;" << control_bytes + 2 * ring_size << ", " << ring_size << R";;();
+      value_arr_ = tape = new );;" << cell_type_() << "(" << initial_tape_size << R";;();
+
+      var faulted = false;
+      try {
+        body();
+      }
+      catch (err) {
+        if (err !== halt_) throw err;
+        faulted = true;
+      }
+      postMessage(faulted ? 'fault' : 'done');
+    };
+  };
+
+  return {
+    init: function(io_mgr) {
+      self_   = this;
+      io_mgr_ = io_mgr;
+    },
+    exe: function() {
+      // SharedArrayBuffer is only there for pages served with
+      //   Cross-Origin-Opener-Policy: same-origin
+      //   Cross-Origin-Embedder-Policy: require-corp
+      if (typeof SharedArrayBuffer === 'undefined') {
+        io_mgr_.put_line('this page has to be served cross-origin isolated to run');
+        return;
+      }
+      var shared = new SharedArrayBuffer();;" << control_bytes + 4 * ring_size << R";;();
+      control_ = new Int32Array(shared, 0, );;" << control_bytes / 4 << R";;();
+      input_   = new Uint16Array(shared, );;" << control_bytes << ", " << ring_size << R";;();
+      output_  = new Uint16Array(shared, );;" << control_bytes + 2 * ring_size << ", " << ring_size << R";;();
+
+      var source = new Blob(['(' + worker_main.toString() + ')();'], { type: 'text/javascript' });
+      var worker = new Worker(URL.createObjectURL(source));
+      worker.onmessage = function(e) {
+        if (e.data === 'space') {
+          if (pending_ !== undefined && self_.feed(pending_)) {
+            pending_ = undefined;
+            self_.pump();
+          }
+          return;
+        }
+        running_ = false;
+        self_.drain();
+        if (e.data === 'fault') io_mgr_.put_line('segmentation fault');
+        worker.terminate();
+      };
+      worker.postMessage(shared);
+
+      running_ = true;
+      self_.drain();
+      self_.pump();
+    },
+    // moves what the program wrote to the page, once a frame while it runs
+    drain: function() {
+      var read    = control_[out_read];
+      var written = Atomics.load(control_, out_written);
+      if (read !== written) {
+        var chunk = [];
+        for (; read !== written; read = (read + 1) | 0) {
+          chunk.push(String.fromCharCode(output_[read & );;" << ring_size - 1 << R";;(]));
+        }
+        Atomics.store(control_, out_read, read);
+        Atomics.notify(control_, out_read);
+        io_mgr_.put_char(chunk.join(''));
+        io_mgr_.flush();
+      }
+      if (running_) window.requestAnimationFrame(self_.drain);
+    },
+    // hands each character to the program as soon as it is typed
+    pump: function() {
+      io_mgr_.read_char().then(function(c) {
+        if (!running_) return;
+        if (self_.feed(c)) {
+          self_.pump();
+        }
+        else {
+          pending_ = c;
+        }
+      });
+    },
+    // false when the input ring is full, the worker says when there is room
+    feed: function(c) {
+      var written = control_[in_written];
+      if (((written - Atomics.load(control_, in_read)) | 0) === );;" << ring_size << R";;() {
+        Atomics.store(control_, want_space, 1);
+        // it may have taken a character before it could see the flag
+        if (((written - Atomics.load(control_, in_read)) | 0) === );;" << ring_size << R";;() return false;
+        Atomics.store(control_, want_space, 0);
+      }
+      input_[written & );;" << ring_size - 1 << R";;(] = c.charCodeAt(0);
+      Atomics.store(control_, in_written, (written + 1) | 0);
+      Atomics.notify(control_, in_written);
+      return true;
+    }
+  };
+};
+);;";
+}
+
+void js_generator::begin() {
+  emit_page_head(file_);
+  if (layout_ == js_layout_t::closures) emit_code_head_();
+}
+
+void js_generator::emit_part(const ir::program& part) {
+  emit_commands_(ir::to_tree(part));
+}
+
+void js_generator::end() {
+  if (layout_ == js_layout_t::closures) emit_code_tail_();
+  emit_page_runtime(script_);
+
+  // the minifier holds on to the end of the script until it is flushed
+  script_.flush();
+  emit_page_tail(file_);
+
+  if (gzip_) {
+    file_.close();
+    if (!file_) throw std::ofstream::failure{ "could not write " + outfile_ };
+    gzip_file(outfile_);
+  }
+}
+
+} // namespace code_gen
+
+} // namespace bf
\ No newline at end of file
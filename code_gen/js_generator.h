@@ -0,0 +1,47 @@
+#pragma once
+#include <fstream>
+#include <ostream>
+#include <string>
+
+#include <cmd/program.h>
+#include <code_gen/code_gen.h>
+#include <code_gen/js_minifier.h>
+
+namespace bf {
+
+namespace code_gen {
+
+// only the closures layout can be streamed, the others look at the whole
+// program to decide what to hoist into functions
+class js_generator : public stream_generator {
+  prog::program p_;
+  std::string   outfile_;
+  std::ofstream file_;
+  js_minifier   minifier_;
+  std::ostream  script_;           // the page's script, through minifier_ when minifying
+  js_layout_t   layout_;
+  unsigned      cell_bits_;
+  bool          gzip_;
+  bool          commands_ = false; // some were written already
+
+  const char* cell_type_() const;
+
+  void emit_code_head_();
+  void emit_commands_(const prog::program& p);
+  void emit_code_tail_();
+  void emit_structured_code_();
+  void emit_worker_code_();
+  void emit_grow_(std::size_t indent = 4);
+public:
+  js_generator(prog::program p, const std::string& outfile, const options& opts = options{ });
+
+  void emit() override;
+
+  void begin() override;
+  void emit_part(const ir::program& part) override;
+  void end() override;
+};
+
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include <code_gen/js_minifier.h>
+
+namespace bf {
+
+namespace code_gen {
+
+static bool word_char(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+}
+
+static bool space_char(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// the nth short name: an underscore, which nothing the generators write
+// starts a name with, then letters and digits
+static std::string short_name(std::size_t n) {
+  static const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  constexpr std::size_t base = sizeof alphabet - 1;
+
+  std::string name;
+  do {
+    name.insert(name.begin(), alphabet[n % base]);
+    n /= base;
+  } while (n-- != 0);
+  return '_' + name;
+}
+
+js_minifier::js_minifier(std::streambuf* out):
+  out_{ out } {
+  setp(buffer_, buffer_ + sizeof buffer_);
+}
+
+js_minifier::~js_minifier() {
+  sync();
+}
+
+void js_minifier::put_(char c) {
+  if (out_->sputc(c) == traits_type::eof()) ok_ = false;
+  last_ = c;
+}
+
+// c starts a token, the whitespace before it is only kept where leaving it
+// out would join two tokens into one
+void js_minifier::put_token_(char c) {
+  if (semi_) {
+    semi_ = false;
+    if (c != '}') put_(';');
+  }
+  if (space_ && ((word_char(last_) && word_char(c)) || (last_ == c && (c == '+' || c == '-')))) {
+    put_(' ');
+  }
+  space_ = false;
+
+  if (c == ';') semi_ = true;
+  else          put_(c);
+}
+
+void js_minifier::put_word_() {
+  if (word_.empty()) return;
+
+  auto word = &word_;
+  if (word_.size() > 1 && word_.back() == '_' && !(word_[0] >= '0' && word_[0] <= '9')) {
+    auto it = names_.find(word_);
+    if (it == std::end(names_)) {
+      it = names_.emplace(word_, short_name(names_.size())).first;
+    }
+    word = &it->second;
+  }
+  put_token_((*word)[0]);
+  for (std::size_t i = 1; i < word->size(); ++i) {
+    put_((*word)[i]);
+  }
+  word_.clear();
+}
+
+void js_minifier::process_(char c) {
+  switch (state_) {
+    case state_t::string:
+      put_(c);
+      if (escape_)        escape_ = false;
+      else if (c == '\\') escape_ = true;
+      else if (c == quote_) state_ = state_t::code;
+      return;
+    case state_t::line_comment:
+      if (c == '\n') {
+        state_ = state_t::code;
+        space_ = true;
+      }
+      return;
+    case state_t::block_comment:
+      if (star_ && c == '/') {
+        state_ = state_t::code;
+        space_ = true;
+      }
+      star_ = c == '*';
+      return;
+    case state_t::code:
+      break;
+  }
+
+  if (slash_) {
+    slash_ = false;
+    if (c == '/') {
+      state_ = state_t::line_comment;
+      return;
+    }
+    if (c == '*') {
+      state_ = state_t::block_comment;
+      star_  = false;
+      return;
+    }
+    put_token_('/');
+  }
+
+  if (word_char(c)) {
+    word_ += c;
+    return;
+  }
+  put_word_();
+
+  if (space_char(c)) {
+    space_ = true;
+  }
+  else if (c == '/') {
+    slash_ = true;
+  }
+  else if (c == '\'' || c == '"') {
+    put_token_(c);
+    state_ = state_t::string;
+    quote_ = c;
+  }
+  else {
+    put_token_(c);
+  }
+}
+
+void js_minifier::process_buffer_() {
+  for (auto c = pbase(); c != pptr(); ++c) {
+    process_(*c);
+  }
+  setp(buffer_, buffer_ + sizeof buffer_);
+}
+
+js_minifier::int_type js_minifier::overflow(int_type c) {
+  process_buffer_();
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    process_(traits_type::to_char_type(c));
+  }
+  return ok_ ? traits_type::not_eof(c) : traits_type::eof();
+}
+
+int js_minifier::sync() {
+  process_buffer_();
+  put_word_();
+  if (slash_) {
+    slash_ = false;
+    put_token_('/');
+  }
+  if (semi_) {
+    semi_ = false;
+    put_(';');
+  }
+  return ok_ && out_->pubsync() == 0 ? 0 : -1;
+}
+
+} // namespace code_gen
+
+} // namespace bf
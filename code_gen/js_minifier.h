@@ -0,0 +1,54 @@
+#pragma once
+#include <streambuf>
+#include <string>
+#include <unordered_map>
+
+namespace bf {
+
+namespace code_gen {
+
+// a streambuf that minifies the javascript written through it and passes the
+// result on to out. it strips comments and whitespace and shortens the names
+// the generators and the page own, the ones ending in an underscore, to an
+// underscore and a letter or two. it only knows the javascript the generators
+// write: no regular expression or template literals, and every statement ends
+// in a semicolon so line breaks can go. a flush ends the current token, so
+// the stream is only flushed between tokens
+class js_minifier : public std::streambuf {
+  enum class state_t {
+    code,
+    string,
+    line_comment,
+    block_comment
+  };
+
+  std::streambuf* out_;
+  char            buffer_[1 << 12];
+  state_t         state_  = state_t::code;
+  char            quote_  = 0;     // the quote the current string ends with
+  bool            escape_ = false; // the last character in a string was a backslash
+  bool            star_   = false; // the last character in a comment was a star
+  bool            slash_  = false; // a slash that may start a comment
+  bool            space_  = false; // whitespace since the last character out
+  bool            semi_   = false; // a semicolon held back in case a brace follows
+  char            last_   = 0;     // the last character out
+  bool            ok_     = true;  // out_ took everything so far
+  std::string     word_;
+  std::unordered_map<std::string, std::string> names_;
+
+  void put_(char c);
+  void put_token_(char c);
+  void put_word_();
+  void process_(char c);
+  void process_buffer_();
+protected:
+  int_type overflow(int_type c) override;
+  int sync() override;
+public:
+  explicit js_minifier(std::streambuf* out);
+  ~js_minifier();
+};
+
+} // namespace code_gen
+
+} // namespace bf
@@ -0,0 +1,264 @@
+#include <code_gen/llvm_ir_generator.h>
+
+#include <string>
+
+#include <runtime/tape.h>
+
+namespace bf {
+
+namespace code_gen {
+
+llvm_ir_generator::llvm_ir_generator(ir::program p, const std::string& outfile):
+  p_{ std::move(p) },
+  file_{ outfile },
+  next_value_{ 0 },
+  next_index_{ 0 } {
+  if (!file_) throw std::ofstream::failure{ "could not open file for writing" };
+}
+
+// bytes of output held back before they are written out
+static constexpr std::size_t out_size = 1 << 16;
+
+static const char fault_message[] = "segmentation fault";
+
+void llvm_ir_generator::emit() {
+  begin();
+  emit_part(p_);
+  end();
+}
+
+void llvm_ir_generator::begin() {
+  file_ <<
+R";;(declare i32 @getchar()
+declare i64 @write(i32, ptr, i64)
+declare ptr @calloc(i64, i64)
+declare void @free(ptr)
+
+; output is collected in @out and written out when it fills, before input
+; is read and at exit
+@out      = internal global [);;" << out_size << R";;( x i8] zeroinitializer
+@out_used = internal global i64 0
+
+@fault_message = internal constant [);;" << sizeof fault_message << R";;( x i8] c");;" << fault_message << R";;(\0A"
+
+define internal void @flush() {
+entry:
+  %used = load i64, ptr @out_used
+  store i64 0, ptr @out_used
+  br label %cond
+cond:
+  %done = phi i64 [ 0, %entry ], [ %next, %body ]
+  %left = sub i64 %used, %done
+  %more = icmp sgt i64 %left, 0
+  br i1 %more, label %body, label %end
+body:
+  %at      = getelementptr i8, ptr @out, i64 %done
+  %written = call i64 @write(i32 1, ptr %at, i64 %left)
+  %next    = add i64 %done, %written
+  %failed  = icmp sle i64 %written, 0
+  br i1 %failed, label %end, label %cond
+end:
+  ret void
+}
+
+define internal void @put(i8 %c) {
+entry:
+  %used = load i64, ptr @out_used
+  %at   = getelementptr i8, ptr @out, i64 %used
+  store i8 %c, ptr %at
+  %next = add i64 %used, 1
+  store i64 %next, ptr @out_used
+  %full = icmp eq i64 %next, );;" << out_size << R";;(
+  br i1 %full, label %flush, label %end
+flush:
+  call void @flush()
+  br label %end
+end:
+  ret void
+}
+
+; the pointer stays in [%first, %end), the offsets on commands may reach
+; max_offset cells past either side. every check that fails branches to
+; %fault
+define i32 @main() {
+entry:
+  %p    = alloca ptr
+  %tape = call ptr @calloc(i64 );;" << runtime::tape::default_size + 2 * ir::max_offset << R";;(, i64 1)
+  %none = icmp eq ptr %tape, null
+  br i1 %none, label %fault, label %start
+start:
+  %first = getelementptr i8, ptr %tape, i64 );;" << ir::max_offset << R";;(
+  %end   = getelementptr i8, ptr %first, i64 );;" << runtime::tape::default_size << R";;(
+  store ptr %first, ptr %p
+);;";
+}
+
+void llvm_ir_generator::end() {
+  file_ <<
+R";;(  call void @flush()
+  call void @free(ptr %tape)
+  ret i32 0
+fault:
+  call void @flush()
+  call i64 @write(i32 2, ptr @fault_message, i64 );;" << sizeof fault_message << R";;()
+  call void @free(ptr %tape)
+  ret i32 1
+}
+);;";
+}
+
+std::string llvm_ir_generator::value_() {
+  return "%v" + std::to_string(next_value_++);
+}
+
+// branches to %fault if at, where the pointer moves by amount or a cell
+// amount away is addressed, is off the tape in that direction. the code
+// after it goes in a block named label
+void llvm_ir_generator::check_(const std::string& at, std::int64_t amount, const std::string& label) {
+  auto off = value_();
+  file_ << "  " << off << (amount < 0 ? " = icmp ult ptr " + at + ", %first\n" : " = icmp uge ptr " + at + ", %end\n")
+        << "  br i1 " << off << ", label %fault, label %" << label << '\n'
+        << label << ":\n";
+}
+
+// returns the name of the address of the cell at offset from the cell pointer
+std::string llvm_ir_generator::cell_ptr_(std::int32_t offset) {
+  auto ptr = value_();
+  file_ << "  " << ptr << " = load ptr, ptr %p\n";
+  if (offset == 0) return ptr;
+  auto at = value_();
+  file_ << "  " << at << " = getelementptr i8, ptr " << ptr << ", i64 " << offset << '\n';
+  return at;
+}
+
+// loads the address of the cell at offset into ptr and returns the name of
+// the loaded cell
+std::string llvm_ir_generator::load_cell_(std::string& ptr, std::int32_t offset) {
+  ptr       = cell_ptr_(offset);
+  auto cell = value_();
+  file_ << "  " << cell << " = load i8, ptr " << ptr << '\n';
+  return cell;
+}
+
+// labels are numbered by the index of the instruction across all parts
+void llvm_ir_generator::emit_part(const ir::program& p) {
+  std::string ptr;
+  for (std::size_t i = 0; i != p.size(); ++i) {
+    auto arg = p.args[i];
+    switch (p.ops[i]) {
+      case ir::op_t::add:
+        {
+          auto cell = load_cell_(ptr, p.offsets[i]);
+          auto sum  = value_();
+          file_ << "  " << sum << " = add i8 " << cell << ", " << static_cast<std::int32_t>(static_cast<std::int8_t>(arg)) << '\n'
+                << "  store i8 " << sum << ", ptr " << ptr << '\n';
+        }
+        break;
+      case ir::op_t::shift:
+        {
+          ptr        = value_();
+          auto moved = value_();
+          file_ << "  " << ptr   << " = load ptr, ptr %p\n"
+                << "  " << moved << " = getelementptr i8, ptr " << ptr << ", i64 " << arg << '\n';
+          check_(moved, arg, "shift" + std::to_string(next_index_ + i));
+          file_ << "  store ptr " << moved << ", ptr %p\n";
+        }
+        break;
+      case ir::op_t::in:
+        {
+          auto c     = value_();
+          auto eof   = value_();
+          auto trunc = value_();
+          auto value = value_();
+          file_ << "  call void @flush()\n"
+                << "  " << c     << " = call i32 @getchar()\n"
+                << "  " << eof   << " = icmp eq i32 " << c << ", -1\n"
+                << "  " << trunc << " = trunc i32 " << c << " to i8\n"
+                << "  " << value << " = select i1 " << eof << ", i8 0, i8 " << trunc << '\n';
+          ptr = cell_ptr_(p.offsets[i]);
+          file_ << "  store i8 " << value << ", ptr " << ptr << '\n';
+        }
+        break;
+      case ir::op_t::out:
+        {
+          auto cell = load_cell_(ptr, p.offsets[i]);
+          file_ << "  call void @put(i8 " << cell << ")\n";
+        }
+        break;
+      case ir::op_t::jz:
+        {
+          // loops are labeled by the index of their head
+          auto label = "loop" + std::to_string(next_index_ + i);
+          file_ << "  br label %" << label << ".cond\n"
+                << label << ".cond:\n";
+          auto cell = load_cell_(ptr);
+          auto cond = value_();
+          file_ << "  " << cond << " = icmp ne i8 " << cell << ", 0\n"
+                << "  br i1 " << cond << ", label %" << label << ".body, label %" << label << ".end\n"
+                << label << ".body:\n";
+        }
+        break;
+      case ir::op_t::jnz:
+        {
+          auto label = "loop" + std::to_string(next_index_ + p.jumps[i]);
+          file_ << "  br label %" << label << ".cond\n"
+                << label << ".end:\n";
+        }
+        break;
+      case ir::op_t::clear:
+        ptr = cell_ptr_(p.offsets[i]);
+        file_ << "  store i8 0, ptr " << ptr << '\n';
+        break;
+      case ir::op_t::mul:
+        {
+          // the target may be off the tape when the loop this came from never ran
+          auto label   = "mul" + std::to_string(next_index_ + i);
+          auto cell    = load_cell_(ptr);
+          auto cond    = value_();
+          auto target  = value_();
+          auto old     = value_();
+          auto product = value_();
+          auto sum     = value_();
+          file_ << "  " << cond << " = icmp ne i8 " << cell << ", 0\n"
+                << "  br i1 " << cond << ", label %" << label << ".body, label %" << label << ".end\n"
+                << label << ".body:\n"
+                << "  " << target  << " = getelementptr i8, ptr " << ptr << ", i64 " << p.offsets[i] << '\n';
+          if (p.offsets[i] < -ir::max_offset || p.offsets[i] > ir::max_offset) {
+            check_(target, p.offsets[i], label + ".reach");
+          }
+          file_ << "  " << old     << " = load i8, ptr " << target << '\n'
+                << "  " << product << " = mul i8 " << cell << ", " << static_cast<std::int32_t>(static_cast<std::int8_t>(arg)) << '\n'
+                << "  " << sum     << " = add i8 " << old << ", " << product << '\n'
+                << "  store i8 " << sum << ", ptr " << target << '\n'
+                << "  br label %" << label << ".end\n"
+                << label << ".end:\n";
+        }
+        break;
+      case ir::op_t::scan:
+        {
+          auto label = "scan" + std::to_string(next_index_ + i);
+          file_ << "  br label %" << label << ".cond\n"
+                << label << ".cond:\n";
+          auto cell  = load_cell_(ptr);
+          auto cond  = value_();
+          auto moved = value_();
+          file_ << "  " << cond << " = icmp ne i8 " << cell << ", 0\n"
+                << "  br i1 " << cond << ", label %" << label << ".body, label %" << label << ".end\n"
+                << label << ".body:\n"
+                << "  " << moved << " = getelementptr i8, ptr " << ptr << ", i64 " << arg << '\n';
+          check_(moved, arg, label + ".step");
+          file_ << "  store ptr " << moved << ", ptr %p\n"
+                << "  br label %" << label << ".cond\n"
+                << label << ".end:\n";
+        }
+        break;
+      case ir::op_t::halt:
+        break; // never produced by the front end
+    }
+  }
+  next_index_ += p.size();
+}
+
+} // namespace code_gen
+
+} // namespace bf
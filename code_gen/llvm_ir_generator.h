@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <fstream>
+#include <string>
+
+#include <code_gen/code_gen.h>
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace code_gen {
+
+// emits textual LLVM IR (opaque pointer form) defining main(). the cell
+// pointer lives in an alloca so the IR stays simple; mem2reg promotes it
+class llvm_ir_generator : public stream_generator {
+  ir::program   p_;
+  std::ofstream file_;
+  std::size_t   next_value_;
+  std::size_t   next_index_; // of the first instruction of the next part
+
+  std::string value_();
+  void check_(const std::string& at, std::int64_t amount, const std::string& label);
+  std::string cell_ptr_(std::int32_t offset);
+  std::string load_cell_(std::string& ptr, std::int32_t offset = 0);
+public:
+  llvm_ir_generator(ir::program p, const std::string& outfile);
+
+  void emit() override;
+
+  void begin() override;
+  void emit_part(const ir::program& part) override;
+  void end() override;
+};
+
+} // namespace code_gen
+
+} // namespace bf
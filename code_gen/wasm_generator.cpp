@@ -0,0 +1,549 @@
+#include <code_gen/wasm_generator.h>
+
+#include <cstdlib>
+
+#include <string>
+
+#include <code_gen/html_shell.h>
+#include <runtime/tape.h>
+
+namespace bf {
+
+namespace code_gen {
+
+namespace {
+
+// the parts of the binary format this backend uses, see
+// https://webassembly.github.io/spec/core/binary/index.html
+namespace wasm {
+
+enum : std::uint8_t {
+  unreachable = 0x00,
+  block       = 0x02,
+  loop        = 0x03,
+  if_         = 0x04,
+  end         = 0x0B,
+  br          = 0x0C,
+  br_if       = 0x0D,
+  br_table    = 0x0E,
+  return_     = 0x0F,
+  call        = 0x10,
+  local_get   = 0x20,
+  local_set   = 0x21,
+  local_tee   = 0x22,
+  global_get  = 0x23,
+  global_set  = 0x24,
+  i32_load8_u = 0x2D,
+  i32_store8  = 0x3A,
+  i32_const   = 0x41,
+  i32_eqz     = 0x45,
+  i32_lt_s    = 0x48,
+  i32_ge_u    = 0x4F,
+  i32_add     = 0x6A,
+  i32_sub     = 0x6B,
+  i32_mul     = 0x6C
+};
+
+enum : std::uint8_t {
+  void_type = 0x40,
+  i32_type  = 0x7F,
+  func_type = 0x60
+};
+
+enum section_t : std::uint8_t {
+  type_section     = 1,
+  import_section   = 2,
+  function_section = 3,
+  memory_section   = 5,
+  global_section   = 6,
+  export_section   = 7,
+  code_section     = 10
+};
+
+struct bytes {
+  std::vector<std::uint8_t> data;
+
+  void put(std::uint8_t b) { data.push_back(b); }
+
+  void uleb(std::uint32_t v) {
+    do {
+      std::uint8_t b = v & 0x7F;
+      v >>= 7;
+      put(v ? b | 0x80 : b);
+    } while (v);
+  }
+
+  void sleb(std::int32_t v) {
+    for (;;) {
+      std::uint8_t b = v & 0x7F;
+      v >>= 7;
+      if ((v == 0 && !(b & 0x40)) || (v == -1 && (b & 0x40))) {
+        put(b);
+        return;
+      }
+      put(b | 0x80);
+    }
+  }
+
+  void name(const std::string& s) {
+    uleb(static_cast<std::uint32_t>(s.size()));
+    data.insert(data.end(), s.begin(), s.end());
+  }
+
+  void append(const bytes& b) { data.insert(data.end(), b.data.begin(), b.data.end()); }
+
+  // a section or function body is preceded by its size in bytes
+  void sized(const bytes& b) {
+    uleb(static_cast<std::uint32_t>(b.data.size()));
+    append(b);
+  }
+};
+
+} // namespace wasm
+
+// function indices, the imports come first
+constexpr std::uint32_t get_char_func = 0;
+constexpr std::uint32_t put_char_func = 1;
+constexpr std::uint32_t run_func      = 2;
+
+// run's locals, the parameter is the block to start at
+constexpr std::uint32_t state_local = 0;
+constexpr std::uint32_t p_local     = 1;
+constexpr std::uint32_t t_local     = 2;
+
+// the pointer is kept in a global while run is suspended on input
+constexpr std::uint32_t p_global = 0;
+
+// what run returns when it did not stop for input
+constexpr std::int32_t finished = -1;
+constexpr std::int32_t faulted  = -2;
+
+constexpr std::int32_t tape_margin = ir::max_offset;
+constexpr std::int32_t tape_size   = static_cast<std::int32_t>(runtime::tape::default_size);
+
+// a wasm function cannot wait for the page to get input, so run returns the
+// block holding the read instead and the page calls it again with that block
+// once there is input. blocks are dispatched by a br_table in a loop:
+//
+//   loop $dispatch
+//     block $bN-1 ... block $b0
+//       br_table $b0 ... $bN-1 (state)
+//     end
+//     ;; b0, falls through to b1
+//     end
+//     ;; b1
+//     ...
+//
+// every read starts a block, and so do the head of and the code after a loop
+// that reads, since resuming has to be able to get back inside it. the loops
+// that don't read, which is where programs spend their time, are plain wasm
+// loops inside a block
+struct run_writer {
+  const ir::program& p;
+  wasm::bytes        code;
+  std::vector<bool>  reads;  // by jz and jnz, if the loop contains a read
+  std::vector<bool>  starts; // by instruction, if a block starts there
+  std::vector<std::uint32_t> block_ids;
+  std::uint32_t      blocks  = 0;
+  std::uint32_t      current = 0; // the block being written
+  std::uint32_t      depth   = 0; // wasm blocks open inside current
+
+  explicit run_writer(const ir::program& p):
+    p{ p },
+    reads(p.size(), false),
+    starts(p.size() + 1, false),
+    block_ids(p.size() + 1, 0) {
+    std::vector<std::size_t> open;
+    for (std::size_t i = 0; i != p.size(); ++i) {
+      if (p.ops[i] == ir::op_t::jz) {
+        open.push_back(i);
+      }
+      else if (p.ops[i] == ir::op_t::jnz) {
+        open.pop_back();
+        reads[i] = reads[p.jumps[i]];
+      }
+      else if (p.ops[i] == ir::op_t::in) {
+        // the loops further out were marked by an earlier read
+        for (auto it = open.rbegin(); it != open.rend() && !reads[*it]; ++it) reads[*it] = true;
+      }
+    }
+
+    starts[0] = true;
+    for (std::size_t i = 0; i != p.size(); ++i) {
+      if (p.ops[i] == ir::op_t::in || (p.ops[i] == ir::op_t::jz && reads[i])) starts[i] = true;
+      if (p.ops[i] == ir::op_t::jnz && reads[i]) starts[i + 1] = true;
+    }
+    for (std::size_t i = 0; i != starts.size(); ++i) {
+      if (starts[i]) ++blocks;
+      block_ids[i] = blocks - 1;
+    }
+  }
+
+  void op(std::uint8_t o) { code.put(o); }
+  void op(std::uint8_t o, std::uint32_t imm) { code.put(o); code.uleb(imm); }
+
+  void i32_const(std::int32_t v) {
+    code.put(wasm::i32_const);
+    code.sleb(v);
+  }
+
+  // pushes the address of the cell at offset, returns the offset to give
+  // the load or store. those only take unsigned offsets
+  std::uint32_t address(std::int32_t offset) {
+    op(wasm::local_get, p_local);
+    if (offset >= 0) return static_cast<std::uint32_t>(offset);
+    i32_const(offset);
+    op(wasm::i32_add);
+    return 0;
+  }
+
+  void load(std::int32_t offset) {
+    auto at = address(offset);
+    op(wasm::i32_load8_u, 0);
+    code.uleb(at);
+  }
+
+  void store(std::uint32_t at) {
+    op(wasm::i32_store8, 0);
+    code.uleb(at);
+  }
+
+  void stop(std::int32_t state) {
+    i32_const(state);
+    op(wasm::return_);
+  }
+
+  // faults if (p + offset) is off the tape
+  void check(std::int32_t offset) {
+    op(wasm::local_get, p_local);
+    i32_const(offset - tape_margin);
+    op(wasm::i32_add);
+    i32_const(tape_size);
+    op(wasm::i32_ge_u);
+    op(wasm::if_, wasm::void_type);
+    stop(faulted);
+    op(wasm::end);
+  }
+
+  void shift(std::int32_t amount) {
+    op(wasm::local_get, p_local);
+    i32_const(amount);
+    op(wasm::i32_add);
+    op(wasm::local_set, p_local);
+    check(0);
+  }
+
+  // continue at the start of block, from an if in current
+  void go_to(std::uint32_t block) {
+    i32_const(static_cast<std::int32_t>(block));
+    op(wasm::local_set, state_local);
+    op(wasm::br, blocks - 1 - current + depth);
+  }
+
+  void write(std::size_t i) {
+    auto arg    = p.args[i];
+    auto offset = p.offsets[i];
+    switch (p.ops[i]) {
+      case ir::op_t::add: {
+        auto at = address(offset);
+        load(offset);
+        i32_const(arg);
+        op(wasm::i32_add);
+        store(at);
+        break;
+      }
+      case ir::op_t::shift:
+        shift(arg);
+        break;
+      case ir::op_t::in: {
+        // get_char returns -1 when there is no input yet, this block is
+        // run again from here when there is
+        op(wasm::call, get_char_func);
+        op(wasm::local_tee, t_local);
+        i32_const(0);
+        op(wasm::i32_lt_s);
+        op(wasm::if_, wasm::void_type);
+        op(wasm::local_get, p_local);
+        op(wasm::global_set, p_global);
+        stop(static_cast<std::int32_t>(current));
+        op(wasm::end);
+        auto at = address(offset);
+        op(wasm::local_get, t_local);
+        store(at);
+        break;
+      }
+      case ir::op_t::out:
+        load(offset);
+        op(wasm::call, put_char_func);
+        break;
+      case ir::op_t::jz:
+        if (reads[i]) {
+          load(0);
+          op(wasm::i32_eqz);
+          op(wasm::if_, wasm::void_type);
+          ++depth;
+          go_to(block_ids[p.jumps[i] + 1]);
+          --depth;
+          op(wasm::end);
+          break;
+        }
+        op(wasm::block, wasm::void_type);
+        load(0);
+        op(wasm::i32_eqz);
+        op(wasm::br_if, 0);
+        op(wasm::loop, wasm::void_type);
+        break;
+      case ir::op_t::jnz:
+        if (reads[i]) {
+          load(0);
+          op(wasm::if_, wasm::void_type);
+          ++depth;
+          go_to(block_ids[p.jumps[i]]);
+          --depth;
+          op(wasm::end);
+          break;
+        }
+        load(0);
+        op(wasm::br_if, 0);
+        op(wasm::end);
+        op(wasm::end);
+        break;
+      case ir::op_t::clear: {
+        auto at = address(offset);
+        i32_const(0);
+        store(at);
+        break;
+      }
+      case ir::op_t::mul: {
+        load(0);
+        op(wasm::local_tee, t_local);
+        op(wasm::if_, wasm::void_type);
+        // the margin covers the nearer targets
+        if (std::abs(offset) > tape_margin) check(offset);
+        auto at = address(offset);
+        load(offset);
+        op(wasm::local_get, t_local);
+        i32_const(arg);
+        op(wasm::i32_mul);
+        op(wasm::i32_add);
+        store(at);
+        op(wasm::end);
+        break;
+      }
+      case ir::op_t::scan:
+        op(wasm::block, wasm::void_type);
+        op(wasm::loop, wasm::void_type);
+        load(0);
+        op(wasm::i32_eqz);
+        op(wasm::br_if, 1);
+        shift(arg);
+        op(wasm::br, 0);
+        op(wasm::end);
+        op(wasm::end);
+        break;
+      case ir::op_t::halt:
+        stop(finished);
+        break;
+    }
+  }
+
+  void write() {
+    code.uleb(1);
+    code.uleb(2);
+    code.put(wasm::i32_type); // p and t
+
+    op(wasm::global_get, p_global);
+    op(wasm::local_set, p_local);
+
+    op(wasm::loop, wasm::void_type);
+    for (std::uint32_t b = 0; b != blocks; ++b) op(wasm::block, wasm::void_type);
+    op(wasm::local_get, state_local);
+    op(wasm::br_table, blocks);
+    for (std::uint32_t b = 0; b != blocks; ++b) code.uleb(b);
+    code.uleb(blocks - 1);
+
+    for (std::size_t i = 0; i != starts.size(); ++i) {
+      if (starts[i]) {
+        op(wasm::end);
+        current = block_ids[i];
+      }
+      if (i != p.size()) write(i);
+    }
+    stop(finished);
+    op(wasm::end);
+    op(wasm::unreachable);
+    op(wasm::end);
+  }
+};
+
+std::string base64(const std::vector<std::uint8_t>& data) {
+  const char* digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string out;
+  out.reserve((data.size() + 2) / 3 * 4);
+  for (std::size_t i = 0; i < data.size(); i += 3) {
+    std::uint32_t n = data[i] << 16;
+    if (i + 1 < data.size()) n |= data[i + 1] << 8;
+    if (i + 2 < data.size()) n |= data[i + 2];
+    out += digits[(n >> 18) & 0x3F];
+    out += digits[(n >> 12) & 0x3F];
+    out += i + 1 < data.size() ? digits[(n >> 6) & 0x3F] : '=';
+    out += i + 2 < data.size() ? digits[n & 0x3F] : '=';
+  }
+  return out;
+}
+
+std::string page_name(const std::string& outfile) {
+  auto dot = outfile.find_last_of('.');
+  auto dir = outfile.find_last_of("/\\");
+  if (dot == std::string::npos || (dir != std::string::npos && dot < dir)) return outfile + ".html";
+  return outfile.substr(0, dot) + ".html";
+}
+
+} // namespace
+
+wasm_generator::wasm_generator(ir::program p, const std::string& outfile):
+  p_{ std::move(p) },
+  file_{ outfile, std::ios::binary },
+  page_{ page_name(outfile) } {
+  if (!file_ || !page_) throw std::ofstream::failure{ "could not open file for writing" };
+}
+
+void wasm_generator::emit() {
+  auto module = module_();
+  file_.write(reinterpret_cast<const char*>(module.data()), static_cast<std::streamsize>(module.size()));
+  emit_page_(module);
+}
+
+std::vector<std::uint8_t> wasm_generator::run_body_() const {
+  run_writer w{ p_ };
+  w.write();
+  return std::move(w.code.data);
+}
+
+std::vector<std::uint8_t> wasm_generator::module_() const {
+  wasm::bytes module;
+  module.data = { 0x00, 0x61, 0x73, 0x6D, 0x01, 0x00, 0x00, 0x00 };
+
+  auto section = [&](wasm::section_t id, const wasm::bytes& contents) {
+    module.put(id);
+    module.sized(contents);
+  };
+
+  // get_char: () -> i32, put_char: (i32) -> (), run: (i32) -> i32
+  wasm::bytes types;
+  types.uleb(3);
+  types.data.insert(types.data.end(), {
+    wasm::func_type, 0, 1, wasm::i32_type,
+    wasm::func_type, 1, wasm::i32_type, 0,
+    wasm::func_type, 1, wasm::i32_type, 1, wasm::i32_type
+  });
+  section(wasm::type_section, types);
+
+  wasm::bytes imports;
+  imports.uleb(2);
+  imports.name("env");
+  imports.name("get_char");
+  imports.put(0x00);
+  imports.uleb(0);
+  imports.name("env");
+  imports.name("put_char");
+  imports.put(0x00);
+  imports.uleb(1);
+  section(wasm::import_section, imports);
+
+  wasm::bytes functions;
+  functions.uleb(1);
+  functions.uleb(2);
+  section(wasm::function_section, functions);
+
+  // the tape with a margin on either side, in 64KiB pages
+  wasm::bytes memory;
+  memory.uleb(1);
+  memory.put(0x00);
+  memory.uleb((tape_size + 2 * tape_margin + 0xFFFF) >> 16);
+  section(wasm::memory_section, memory);
+
+  wasm::bytes globals;
+  globals.uleb(1);
+  globals.put(wasm::i32_type);
+  globals.put(0x01); // mutable
+  globals.put(wasm::i32_const);
+  globals.sleb(tape_margin);
+  globals.put(wasm::end);
+  section(wasm::global_section, globals);
+
+  wasm::bytes exports;
+  exports.uleb(1);
+  exports.name("run");
+  exports.put(0x00);
+  exports.uleb(run_func);
+  section(wasm::export_section, exports);
+
+  wasm::bytes body;
+  body.data = run_body_();
+  wasm::bytes code;
+  code.uleb(1);
+  code.sized(body);
+  section(wasm::code_section, code);
+
+  return std::move(module.data);
+}
+
+void wasm_generator::emit_page_(const std::vector<std::uint8_t>& module) {
+  emit_page_head(page_);
+  page_ <<
+R";;(var Program = function() {
+  var self_   = undefined;
+  var io_mgr_ = undefined;
+  var run_    = undefined;
+  var state_  = 0;
+  var input_  = undefined;
+  var module_ = ');;" << base64(module) << R";;(';
+
+  return {
+    init: function(io_mgr) {
+      self_   = this;
+      io_mgr_ = io_mgr;
+    },
+    exe: function() {
+      var bytes = Uint8Array.from(atob(module_), function(c) { return c.charCodeAt(0); });
+      var env = {
+        // the character run was waiting on when it is resumed
+        get_char: function() {
+          var input = input_ !== undefined ? input_ : io_mgr_.poll_char();
+          input_ = undefined;
+          return input === undefined ? -1 : input.charCodeAt(0);
+        },
+        put_char: function(c) {
+          io_mgr_.put_char(String.fromCharCode(c));
+        }
+      };
+      WebAssembly.instantiate(bytes, { env: env }).then(function(result) {
+        run_ = result.instance.exports.run;
+        self_.resume();
+      });
+    },
+    // run returns the block to resume at when it is out of input
+    resume: function() {
+      state_ = run_(state_);
+      io_mgr_.flush();
+      if (state_ === );;" << faulted << R";;() {
+        io_mgr_.put_line('segmentation fault');
+      }
+      else if (state_ >= 0) {
+        io_mgr_.read_char().then(function(c) {
+          input_ = c;
+          self_.resume();
+        });
+      }
+    }
+  };
+};
+);;";
+  emit_page_runtime(page_);
+  emit_page_tail(page_);
+}
+
+} // namespace code_gen
+
+} // namespace bf
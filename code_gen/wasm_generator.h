@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <code_gen/code_gen.h>
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace code_gen {
+
+// emits a binary WebAssembly module with the tape in its linear memory and
+// get_char/put_char imported from the page. the module is written to outfile
+// and, because pages opened from disk cannot fetch it, also inlined into a page
+// next to it with the same name ending in .html
+class wasm_generator : public generator {
+  ir::program   p_;
+  std::ofstream file_;
+  std::ofstream page_;
+
+  std::vector<std::uint8_t> module_() const;
+  std::vector<std::uint8_t> run_body_() const;
+
+  void emit_page_(const std::vector<std::uint8_t>& module);
+public:
+  wasm_generator(ir::program p, const std::string& outfile);
+
+  void emit() override;
+};
+
+} // namespace code_gen
+
+} // namespace bf
@@ -0,0 +1,134 @@
+#include <interp/interpreter.h>
+
+#include <iostream>
+
+#include <runtime/scan.h>
+
+// GCC and clang let us jump straight to the next handler (computed goto),
+// which gives the branch predictor one indirect jump per handler instead of a
+// single shared one in the switch
+#if defined(__GNUC__)
+#define BF_THREADED_DISPATCH 1
+#else
+#define BF_THREADED_DISPATCH 0
+#endif
+
+namespace bf {
+
+namespace interp {
+
+interpreter::interpreter(ir::program p):
+  code_{ std::move(p) },
+  tape_{ runtime::tape::default_size, ir::max_offset },
+  io_{ } {
+  code_.push(ir::op_t::halt);
+}
+
+int interpreter::run() {
+  return run_<false>(nullptr);
+}
+
+int interpreter::run(std::vector<std::uint64_t>& counts) {
+  counts.assign(code_.size(), 0);
+  return run_<true>(counts.data());
+}
+
+template <bool counting>
+int interpreter::run_(std::uint64_t* counts) {
+  const ir::op_t*      ops   = code_.ops.data();
+  const std::int32_t*  args  = code_.args.data();
+  const std::int32_t*  offs  = code_.offsets.data();
+  const std::uint32_t* jumps = code_.jumps.data();
+  std::size_t          pc    = 0;
+  std::uint8_t*        first = tape_.begin();
+  std::uint8_t*        cell  = first;
+  const std::size_t    size  = tape_.size();
+
+#define BF_COUNT() if (counting) ++counts[pc]
+
+#if BF_THREADED_DISPATCH
+  // must match the order of ir::op_t
+  static void* const handlers[] = {
+    &&op_add,
+    &&op_shift,
+    &&op_in,
+    &&op_out,
+    &&op_jz,
+    &&op_jnz,
+    &&op_clear,
+    &&op_mul,
+    &&op_scan,
+    &&op_halt
+  };
+#define BF_CASE(name) op_##name
+#define BF_NEXT()     do { BF_COUNT(); goto *handlers[static_cast<std::size_t>(ops[pc])]; } while (0)
+  BF_NEXT();
+#else
+#define BF_CASE(name) case ir::op_t::name
+#define BF_NEXT()     continue
+  for (;;) {
+    BF_COUNT();
+    switch (ops[pc]) {
+#endif
+
+  BF_CASE(add):
+    cell[offs[pc]] = static_cast<std::uint8_t>(cell[offs[pc]] + args[pc]);
+    ++pc;
+    BF_NEXT();
+  BF_CASE(shift):
+    // a single unsigned compare catches running off either end
+    if (static_cast<std::size_t>(cell - first + args[pc]) >= size) goto fault;
+    cell += args[pc];
+    ++pc;
+    BF_NEXT();
+  BF_CASE(in):
+    cell[offs[pc]] = io_.get();
+    ++pc;
+    BF_NEXT();
+  BF_CASE(out):
+    io_.put(cell[offs[pc]]);
+    ++pc;
+    BF_NEXT();
+  BF_CASE(jz):
+    pc = *cell ? pc + 1 : jumps[pc] + 1;
+    BF_NEXT();
+  BF_CASE(jnz):
+    pc = *cell ? jumps[pc] + 1 : pc + 1;
+    BF_NEXT();
+  BF_CASE(clear):
+    cell[offs[pc]] = 0;
+    ++pc;
+    BF_NEXT();
+  BF_CASE(mul):
+    if (*cell) {
+      if (static_cast<std::size_t>(cell - first + offs[pc]) >= size) goto fault;
+      cell[offs[pc]] = static_cast<std::uint8_t>(cell[offs[pc]] + *cell * args[pc]);
+    }
+    ++pc;
+    BF_NEXT();
+  BF_CASE(scan):
+    cell = runtime::find_zero(cell, args[pc], first, first + size);
+    if (!cell) goto fault;
+    ++pc;
+    BF_NEXT();
+  BF_CASE(halt):
+    io_.flush();
+    return 0;
+
+#if !BF_THREADED_DISPATCH
+    }
+  }
+#endif
+#undef BF_COUNT
+#undef BF_CASE
+#undef BF_NEXT
+
+fault:
+  io_.flush();
+  std::cerr << "segmentation fault\n";
+  return 1;
+}
+
+} // namespace interp
+
+} // namespace bf
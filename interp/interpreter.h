@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+
+#include <vector>
+
+#include <ir/ir.h>
+#include <runtime/io.h>
+#include <runtime/tape.h>
+
+namespace bf {
+
+namespace interp {
+
+class interpreter {
+  ir::program   code_;
+  runtime::tape tape_;
+  runtime::io   io_;
+
+  template <bool counting>
+  int run_(std::uint64_t* counts);
+public:
+  interpreter(ir::program p);
+
+  // returns 0 on success, non-zero if the program ran off the tape
+  int run();
+  // as run(), also counting how many times each instruction executes. counts
+  // ends up with one entry per instruction plus one for the trailing halt
+  int run(std::vector<std::uint64_t>& counts);
+
+  // the program as run, the trailing halt included
+  const ir::program& code() const { return code_; }
+};
+
+} // namespace interp
+
+} // namespace bf
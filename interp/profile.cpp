@@ -0,0 +1,137 @@
+#include <interp/profile.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <string>
+
+#include <lex/lexer.h>
+
+namespace bf {
+
+namespace interp {
+
+// how many loops the report lists and how much of each one it quotes
+constexpr std::size_t report_loops   = 20;
+constexpr std::size_t report_excerpt = 40;
+
+static const char* op_name(ir::op_t op) {
+  switch (op) {
+    case ir::op_t::add:   return "add";
+    case ir::op_t::shift: return "shift";
+    case ir::op_t::in:    return "in";
+    case ir::op_t::out:   return "out";
+    case ir::op_t::jz:    return "jz";
+    case ir::op_t::jnz:   return "jnz";
+    case ir::op_t::clear: return "clear";
+    case ir::op_t::mul:   return "mul";
+    case ir::op_t::scan:  return "scan";
+    case ir::op_t::halt:  return "halt";
+  }
+  return "";
+}
+
+std::vector<loop_profile> profile_loops(const ir::program& p, const std::vector<std::uint64_t>& counts) {
+  std::vector<loop_profile>  loops;
+  std::vector<std::size_t>   open;   // loops entered but not yet closed
+  std::vector<std::uint64_t> nested; // what the loops directly inside each open loop executed
+  std::uint64_t executed = 0;        // everything before instruction i
+  auto n = std::min(p.size(), counts.size());
+  for (std::size_t i = 0; i != n; ++i) {
+    if (p.ops[i] == ir::op_t::jz) {
+      open.push_back(loops.size());
+      nested.push_back(0);
+      loops.push_back({ i, counts[i], 0, executed, 0 }); // total holds where the loop starts until it closes
+    }
+    executed += counts[i];
+    if (p.ops[i] == ir::op_t::jnz && !open.empty()) {
+      auto& l = loops[open.back()];
+      l.iterations = counts[i];
+      l.total      = executed - l.total;
+      l.self       = l.total - nested.back();
+      open.pop_back();
+      nested.pop_back();
+      if (!nested.empty()) nested.back() += l.total;
+    }
+  }
+  return loops;
+}
+
+void report(std::ostream& os, const ir::program& p, const std::vector<std::uint64_t>& counts, const lex::lexer& l, double seconds) {
+  auto n = std::min(p.size(), counts.size());
+
+  // the halt the interpreter appends is not part of the program
+  std::uint64_t total = 0;
+  std::uint64_t by_op[static_cast<std::size_t>(ir::op_t::halt) + 1] = { };
+  for (std::size_t i = 0; i != n; ++i) {
+    if (p.ops[i] == ir::op_t::halt) continue;
+    total += counts[i];
+    by_op[static_cast<std::size_t>(p.ops[i])] += counts[i];
+  }
+  auto share = [&](std::uint64_t part) {
+    return total == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(total);
+  };
+
+  auto flags = os.flags();
+  os << std::fixed << std::setprecision(3)
+     << "profile: " << total << " instructions executed in " << seconds << "s\n";
+
+  // the instruction mix, most executed first
+  std::vector<ir::op_t> ops;
+  for (std::size_t op = 0; op != static_cast<std::size_t>(ir::op_t::halt); ++op) {
+    if (by_op[op] != 0) ops.push_back(static_cast<ir::op_t>(op));
+  }
+  std::stable_sort(ops.begin(), ops.end(), [&](ir::op_t a, ir::op_t b) {
+    return by_op[static_cast<std::size_t>(a)] > by_op[static_cast<std::size_t>(b)];
+  });
+  os << std::setprecision(1) << "instruction mix:";
+  for (auto op : ops) {
+    os << ' ' << op_name(op) << ' ' << share(by_op[static_cast<std::size_t>(op)]) << '%';
+  }
+  os << '\n';
+
+  auto loops = profile_loops(p, counts);
+  loops.erase(std::remove_if(loops.begin(), loops.end(), [](const loop_profile& lp) { return lp.entries == 0; }), loops.end());
+  if (loops.empty()) {
+    os << "no loops ran\n";
+    os.flags(flags);
+    return;
+  }
+  std::stable_sort(loops.begin(), loops.end(), [](const loop_profile& a, const loop_profile& b) {
+    return a.total > b.total;
+  });
+  if (loops.size() > report_loops) loops.resize(report_loops);
+
+  // placing the loops first sizes the location column
+  std::vector<std::string> places;
+  std::size_t width = 8;
+  for (const auto& lp : loops) {
+    auto pos = l.locate(p.origins[lp.head]);
+    places.push_back(pos.name + '(' + std::to_string(pos.line) + ':' + std::to_string(pos.col) + ')');
+    width = std::max(width, places.back().size());
+  }
+
+  os << "hottest loops:\n"
+     << std::left << std::setw(static_cast<int>(width)) << "location" << std::right
+     << std::setw(14) << "entries"
+     << std::setw(16) << "iterations"
+     << std::setw(12) << "avg trip"
+     << std::setw(9)  << "total"
+     << std::setw(9)  << "self"
+     << "  loop\n";
+  for (std::size_t i = 0; i != loops.size(); ++i) {
+    const auto& lp = loops[i];
+    auto tail = p.jumps[lp.head];
+    os << std::left << std::setw(static_cast<int>(width)) << places[i] << std::right
+       << std::setw(14) << lp.entries
+       << std::setw(16) << lp.iterations
+       << std::setw(12) << static_cast<double>(lp.iterations) / static_cast<double>(lp.entries)
+       << std::setw(8)  << share(lp.total) << '%'
+       << std::setw(8)  << share(lp.self) << '%'
+       << "  " << l.excerpt(p.origins[lp.head], std::size_t{ p.origins[tail] } + 1, report_excerpt) << '\n';
+  }
+  os.flags(flags);
+}
+
+} // namespace interp
+
+} // namespace bf
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <ostream>
+#include <vector>
+
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace lex { class lexer; }
+
+namespace interp {
+
+// what the instructions counted by interpreter::run(counts) add up to for
+// one loop
+struct loop_profile {
+  std::size_t   head;       // index of the loop's jz
+  std::uint64_t entries;    // times the loop was reached
+  std::uint64_t iterations; // times its body ran
+  std::uint64_t total;      // instructions executed inside it, nested loops included
+  std::uint64_t self;       // instructions executed inside it, nested loops excluded
+};
+
+// one entry per loop of p in program order, counts as filled in by
+// interpreter::run(counts)
+std::vector<loop_profile> profile_loops(const ir::program& p, const std::vector<std::uint64_t>& counts);
+
+// writes the instruction mix and the hottest loops of a profiled run, placed
+// with the lexer p was parsed from. shares of time are shares of the
+// instructions executed
+void report(std::ostream& os, const ir::program& p, const std::vector<std::uint64_t>& counts, const lex::lexer& l, double seconds);
+
+} // namespace interp
+
+} // namespace bf
@@ -0,0 +1,133 @@
+#include <ir/ir.h>
+
+// commands
+#include <cmd/arithmetic.h>
+#include <cmd/clear.h>
+#include <cmd/io.h>
+#include <cmd/loop.h>
+#include <cmd/multiply.h>
+#include <cmd/scan.h>
+#include <cmd/shift.h>
+
+namespace bf {
+
+namespace ir {
+
+void relink(program& p) {
+  std::vector<std::size_t> heads;
+  for (std::size_t i = 0; i != p.size(); ++i) {
+    if (p.ops[i] == op_t::jz) {
+      heads.push_back(i);
+    }
+    else if (p.ops[i] == op_t::jnz) {
+      p.jumps[heads.back()] = static_cast<std::uint32_t>(i);
+      p.jumps[i]            = static_cast<std::uint32_t>(heads.back());
+      heads.pop_back();
+    }
+  }
+}
+
+static void lower_cmd(const cmd::command& c, program& code) {
+  struct lower_visitor : cmd::command::visitor {
+    program* code;
+    lower_visitor(program& code) : code{ &code } { }
+
+    void operator()(const cmd::arithmetic& a) const override {
+      auto amount = (a.type == cmd::arithmetic::arith_type::add ? static_cast<std::int32_t>(a.amount) : -static_cast<std::int32_t>(a.amount));
+      code->push(op_t::add, amount, a.offset);
+    }
+    void operator()(const cmd::clear& c) const override {
+      code->push(op_t::clear, 0, c.offset);
+    }
+    void operator()(const cmd::io& io) const override {
+      code->push(io.type == cmd::io::io_type::in ? op_t::in : op_t::out, 0, io.offset);
+    }
+    void operator()(const cmd::multiply& m) const override {
+      code->push(op_t::mul, m.factor, m.offset);
+    }
+    void operator()(const cmd::scan& s) const override {
+      code->push(op_t::scan, s.type == cmd::scan::scan_type::right ? static_cast<std::int32_t>(s.stride) : -static_cast<std::int32_t>(s.stride));
+    }
+    void operator()(const cmd::shift& s) const override {
+      auto amount = (s.type == cmd::shift::shift_type::right ? static_cast<std::int32_t>(s.amount) : -static_cast<std::int32_t>(s.amount));
+      code->push(op_t::shift, amount);
+    }
+    void operator()(const cmd::loop& l) const override {
+      auto head = code->open_loop();
+      for (const auto& stmt : l.statements) {
+        stmt->accept(*this);
+      }
+      code->close_loop(head);
+    }
+  } visitor{ code };
+  c.accept(visitor);
+}
+
+program lower(const prog::program& p) {
+  program code;
+  for (const auto& c : p) {
+    lower_cmd(*c, code);
+  }
+  return code;
+}
+
+// converts [first, last) into commands, last is either the end of the program
+// or the tail of the loop being built
+static std::vector<const cmd::command*> to_cmds(const program& p, std::size_t first, std::size_t last, cmd::arena& arena) {
+  std::vector<const cmd::command*> cmds;
+  while (first != last) {
+    auto arg    = p.args[first];
+    auto offset = p.offsets[first];
+    switch (p.ops[first]) {
+      case op_t::add:
+        if (arg < 0) cmds.push_back(arena.make<cmd::arithmetic>(cmd::arithmetic::arith_type::sub, static_cast<std::uint32_t>(-arg), offset));
+        else         cmds.push_back(arena.make<cmd::arithmetic>(cmd::arithmetic::arith_type::add, static_cast<std::uint32_t>(arg), offset));
+        break;
+      case op_t::shift:
+        if (arg < 0) cmds.push_back(arena.make<cmd::shift>(cmd::shift::shift_type::left, static_cast<std::uint32_t>(-arg)));
+        else         cmds.push_back(arena.make<cmd::shift>(cmd::shift::shift_type::right, static_cast<std::uint32_t>(arg)));
+        break;
+      case op_t::in:
+        cmds.push_back(arena.make<cmd::io>(cmd::io::io_type::in, offset));
+        break;
+      case op_t::out:
+        cmds.push_back(arena.make<cmd::io>(cmd::io::io_type::out, offset));
+        break;
+      case op_t::jz:
+        {
+          auto tail = p.jumps[first];
+          auto body = to_cmds(p, first + 1, tail, arena);
+          cmds.push_back(arena.make<cmd::loop>(arena.copy(body.data(), body.size())));
+          first = tail;
+        }
+        break;
+      case op_t::clear:
+        cmds.push_back(arena.make<cmd::clear>(offset));
+        break;
+      case op_t::mul:
+        cmds.push_back(arena.make<cmd::multiply>(offset, arg));
+        break;
+      case op_t::scan:
+        if (arg < 0) cmds.push_back(arena.make<cmd::scan>(cmd::scan::scan_type::left, static_cast<std::uint32_t>(-arg)));
+        else         cmds.push_back(arena.make<cmd::scan>(cmd::scan::scan_type::right, static_cast<std::uint32_t>(arg)));
+        break;
+      case op_t::jnz:
+      case op_t::halt:
+        break; // noop
+    }
+    ++first;
+  }
+  return cmds;
+}
+
+prog::program to_tree(const program& p) {
+  prog::program tree;
+  for (auto c : to_cmds(p, 0, p.size(), tree.arena())) {
+    tree.push_back(c);
+  }
+  return tree;
+}
+
+} // namespace ir
+
+} // namespace bf
@@ -0,0 +1,106 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <vector>
+
+#include <cmd/program.h>
+
+namespace bf {
+
+namespace ir {
+
+enum class op_t : std::uint8_t {
+  add,   // p[offset] += arg
+  shift, // p += arg
+  in,    // p[offset] = getchar()
+  out,   // putchar(p[offset])
+  jz,    // loop head, if (*p == 0) continue past jump
+  jnz,   // loop tail, if (*p != 0) continue past jump
+  clear, // p[offset] = 0
+  mul,   // p[offset] += *p * arg
+  scan,  // while (*p) p += arg
+  halt   // sentinel for backends that want one, never produced by the front end
+};
+
+// a program as a flat, struct-of-arrays instruction stream. each instruction
+// is an opcode, an operand, the cell it addresses relative to p and, for loop
+// instructions, the index of the matching bracket. this is far denser than
+// the command tree and is what the optimizer and every backend consume.
+// origins only serve diagnostics such as the profiler, they hold the source
+// offset of the token an instruction came from (0 when it isn't known). they
+// are kept as narrow as the other columns, offsets past 4 GiB are clamped
+struct program {
+  std::vector<op_t>          ops;
+  std::vector<std::int32_t>  args;
+  std::vector<std::int32_t>  offsets;
+  std::vector<std::uint32_t> jumps;
+  std::vector<std::uint32_t> origins;
+  unsigned                   cell_bits = 8; // cells wrap at 2^cell_bits
+
+  std::size_t size() const { return ops.size(); }
+  bool empty() const { return ops.empty(); }
+
+  void push(op_t op, std::int32_t arg = 0, std::int32_t offset = 0, std::size_t origin = 0) {
+    ops.push_back(op);
+    args.push_back(arg);
+    offsets.push_back(offset);
+    jumps.push_back(0);
+    constexpr std::size_t max_origin = std::numeric_limits<std::uint32_t>::max();
+    origins.push_back(static_cast<std::uint32_t>(origin < max_origin ? origin : max_origin));
+  }
+  // returns the index of the loop head, to be handed back to close_loop
+  std::size_t open_loop(std::size_t origin = 0) {
+    push(op_t::jz, 0, 0, origin);
+    return size() - 1;
+  }
+  void close_loop(std::size_t head, std::size_t origin = 0) {
+    push(op_t::jnz, 0, 0, origin);
+    jumps[head]        = static_cast<std::uint32_t>(size() - 1);
+    jumps[size() - 1]  = static_cast<std::uint32_t>(head);
+  }
+  void resize(std::size_t n) {
+    ops.resize(n);
+    args.resize(n);
+    offsets.resize(n);
+    jumps.resize(n);
+    origins.resize(n);
+  }
+  // copies instruction from over instruction to, leaving jumps to relink()
+  void move(std::size_t from, std::size_t to) {
+    ops[to]     = ops[from];
+    args[to]    = args[from];
+    offsets[to] = offsets[from];
+    origins[to] = origins[from];
+  }
+};
+
+// the offsets of add, in, out and clear stay within +/- max_offset, backends
+// keep that much slack on either side of the tape so they can go unchecked
+constexpr std::int32_t max_offset = 1 << 12;
+
+inline bool ill_formed(const program& p) { return p.empty(); }
+
+// amount as the smallest signed value with the same effect on a cell of p
+inline std::int32_t wrap(const program& p, std::int32_t amount) {
+  switch (p.cell_bits) {
+    case 8:  return static_cast<std::int8_t>(amount);
+    case 16: return static_cast<std::int16_t>(amount);
+    default: return amount;
+  }
+}
+
+// recomputes the jump of every loop instruction after the program has been
+// rewritten
+void relink(program& p);
+
+// flattens a command tree
+program lower(const prog::program& p);
+
+// builds the command tree view of a flat program, e.g. for dumping it
+prog::program to_tree(const program& p);
+
+} // namespace ir
+
+} // namespace bf
@@ -0,0 +1,306 @@
+#include <jit/jit.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <runtime/scan.h>
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#define BF_JIT_X86_64 1
+#include <sys/mman.h>
+#else
+#define BF_JIT_X86_64 0
+#endif
+
+namespace bf {
+
+namespace jit {
+
+bool supported() {
+  return BF_JIT_X86_64 != 0;
+}
+
+#if BF_JIT_X86_64
+
+// signature of the emitted code, returns 0 on success and 1 on a tape fault
+using entry_t = int (*)(std::uint8_t* tape, std::size_t size, runtime::io* io);
+
+// runtime stubs called from generated code
+static void put_stub(runtime::io* io, int c) {
+  io->put(static_cast<std::uint8_t>(c));
+}
+
+static int get_stub(runtime::io* io) {
+  return io->get();
+}
+
+// register assignment for the emitted code, all callee saved so they survive
+// calls into the stubs:
+//   rbx - pointer to the current cell
+//   r12 - start of the tape
+//   r13 - size of the tape
+//   r14 - runtime::io*
+//   r15 - cached value of the current cell, written back before pointer moves.
+//         cells at a nonzero offset are always accessed in memory
+class emitter {
+  std::vector<std::uint8_t> code_;
+  std::vector<std::size_t>  fault_patches_;
+
+  void bytes_(std::initializer_list<std::uint8_t> bs) {
+    code_.insert(std::end(code_), bs);
+  }
+  void imm32_(std::int32_t v) {
+    auto u = static_cast<std::uint32_t>(v);
+    for (int i = 0; i < 4; ++i) code_.push_back(static_cast<std::uint8_t>(u >> (i * 8)));
+  }
+  void imm64_(std::uint64_t v) {
+    for (int i = 0; i < 8; ++i) code_.push_back(static_cast<std::uint8_t>(v >> (i * 8)));
+  }
+  void call_(const void* fn) {
+    bytes_({ 0x4C, 0x89, 0xF7 });                     // mov rdi, r14
+    bytes_({ 0x48, 0xB8 });                           // mov rax, imm64
+    imm64_(reinterpret_cast<std::uint64_t>(fn));
+    bytes_({ 0xFF, 0xD0 });                           // call rax
+  }
+  void store_cell_() { bytes_({ 0x44, 0x88, 0x3B }); }       // mov [rbx], r15b
+  void load_cell_()  { bytes_({ 0x44, 0x0F, 0xB6, 0x3B }); } // movzx r15d, byte [rbx]
+  void test_cell_()  { bytes_({ 0x45, 0x84, 0xFF }); }       // test r15b, r15b
+public:
+  std::size_t size() const { return code_.size(); }
+  const std::uint8_t* data() const { return code_.data(); }
+
+  void patch_rel32(std::size_t at, std::size_t target) {
+    auto rel = static_cast<std::int32_t>(static_cast<std::int64_t>(target) - static_cast<std::int64_t>(at + 4));
+    std::memcpy(&code_[at], &rel, sizeof(rel));
+  }
+
+  void prologue() {
+    bytes_({ 0x53 });                   // push rbx
+    bytes_({ 0x41, 0x54 });             // push r12
+    bytes_({ 0x41, 0x55 });             // push r13
+    bytes_({ 0x41, 0x56 });             // push r14
+    bytes_({ 0x41, 0x57 });             // push r15, the stack is now 16 byte aligned
+    bytes_({ 0x49, 0x89, 0xFC });       // mov r12, rdi
+    bytes_({ 0x48, 0x89, 0xFB });       // mov rbx, rdi
+    bytes_({ 0x49, 0x89, 0xF5 });       // mov r13, rsi
+    bytes_({ 0x49, 0x89, 0xD6 });       // mov r14, rdx
+    load_cell_();
+  }
+  void epilogue() {
+    bytes_({ 0x31, 0xC0 });             // xor eax, eax
+    auto exit_jump = code_.size() + 1;
+    bytes_({ 0xEB, 0x00 });             // jmp exit
+    auto fault = code_.size();
+    bytes_({ 0xB8 }); imm32_(1);        // mov eax, 1
+    code_[exit_jump] = static_cast<std::uint8_t>(code_.size() - exit_jump - 1);
+    bytes_({ 0x41, 0x5F });             // pop r15
+    bytes_({ 0x41, 0x5E });             // pop r14
+    bytes_({ 0x41, 0x5D });             // pop r13
+    bytes_({ 0x41, 0x5C });             // pop r12
+    bytes_({ 0x5B });                   // pop rbx
+    bytes_({ 0xC3 });                   // ret
+
+    for (auto at : fault_patches_) {
+      patch_rel32(at, fault);
+    }
+  }
+
+  void add(std::int32_t amount, std::int32_t offset) {
+    if (offset == 0) {
+      bytes_({ 0x41, 0x80, 0xC7, static_cast<std::uint8_t>(amount) }); // add r15b, imm8
+      return;
+    }
+    bytes_({ 0x80, 0x83 }); imm32_(offset);  // add byte [rbx + offset], imm8
+    bytes_({ static_cast<std::uint8_t>(amount) });
+  }
+  void shift(std::int32_t amount) {
+    store_cell_();
+    bytes_({ 0x48, 0x81, 0xC3 }); imm32_(amount); // add rbx, imm32
+    bytes_({ 0x48, 0x89, 0xD8 });                 // mov rax, rbx
+    bytes_({ 0x4C, 0x29, 0xE0 });                 // sub rax, r12
+    bytes_({ 0x4C, 0x39, 0xE8 });                 // cmp rax, r13
+    bytes_({ 0x0F, 0x83 });                       // jae fault
+    fault_patches_.push_back(code_.size());
+    imm32_(0);
+    load_cell_();
+  }
+  void clear(std::int32_t offset) {
+    if (offset == 0) {
+      bytes_({ 0x45, 0x31, 0xFF });     // xor r15d, r15d
+      return;
+    }
+    bytes_({ 0xC6, 0x83 }); imm32_(offset); // mov byte [rbx + offset], 0
+    bytes_({ 0x00 });
+  }
+  void mul(std::int32_t offset, std::int32_t factor) {
+    // a zero cell means the loop this came from never ran, which matters
+    // when the target would be off the tape
+    test_cell_();
+    bytes_({ 0x74, 0x00 });                       // jz skip
+    auto skip = code_.size();
+    bytes_({ 0x48, 0x8D, 0x83 }); imm32_(offset); // lea rax, [rbx + offset]
+    bytes_({ 0x4C, 0x29, 0xE0 });                 // sub rax, r12
+    bytes_({ 0x4C, 0x39, 0xE8 });                 // cmp rax, r13
+    bytes_({ 0x0F, 0x83 });                       // jae fault
+    fault_patches_.push_back(code_.size());
+    imm32_(0);
+    bytes_({ 0x41, 0x0F, 0xB6, 0xC7 });           // movzx eax, r15b
+    bytes_({ 0x69, 0xC0 }); imm32_(factor);       // imul eax, eax, factor
+    bytes_({ 0x00, 0x83 }); imm32_(offset);       // add [rbx + offset], al
+    code_[skip - 1] = static_cast<std::uint8_t>(code_.size() - skip);
+  }
+  void scan(std::int32_t stride) {
+    test_cell_();
+    bytes_({ 0x74, 0x00 });                       // jz skip
+    auto skip = code_.size();
+    store_cell_();
+    bytes_({ 0x48, 0x89, 0xDF });                 // mov rdi, rbx
+    bytes_({ 0xBE }); imm32_(stride);             // mov esi, stride
+    bytes_({ 0x4C, 0x89, 0xE2 });                 // mov rdx, r12
+    bytes_({ 0x4B, 0x8D, 0x0C, 0x2C });           // lea rcx, [r12 + r13]
+    bytes_({ 0x48, 0xB8 });                       // mov rax, imm64
+    imm64_(reinterpret_cast<std::uint64_t>(&runtime::find_zero));
+    bytes_({ 0xFF, 0xD0 });                       // call rax
+    bytes_({ 0x48, 0x85, 0xC0 });                 // test rax, rax
+    bytes_({ 0x0F, 0x84 });                       // jz fault
+    fault_patches_.push_back(code_.size());
+    imm32_(0);
+    bytes_({ 0x48, 0x89, 0xC3 });                 // mov rbx, rax
+    clear(0);                                     // the scan stopped on a zero
+    code_[skip - 1] = static_cast<std::uint8_t>(code_.size() - skip);
+  }
+  void out(std::int32_t offset) {
+    if (offset == 0) {
+      bytes_({ 0x41, 0x0F, 0xB6, 0xF7 });     // movzx esi, r15b
+    }
+    else {
+      bytes_({ 0x0F, 0xB6, 0xB3 }); imm32_(offset); // movzx esi, byte [rbx + offset]
+    }
+    call_(reinterpret_cast<const void*>(&put_stub));
+  }
+  void in(std::int32_t offset) {
+    call_(reinterpret_cast<const void*>(&get_stub));
+    if (offset == 0) {
+      bytes_({ 0x44, 0x0F, 0xB6, 0xF8 });     // movzx r15d, al
+    }
+    else {
+      bytes_({ 0x88, 0x83 }); imm32_(offset); // mov [rbx + offset], al
+    }
+  }
+  // returns the offset of the rel32 to patch with the end of the loop
+  std::size_t loop_begin() {
+    test_cell_();
+    bytes_({ 0x0F, 0x84 });             // jz end
+    auto at = code_.size();
+    imm32_(0);
+    return at;
+  }
+  void loop_end(std::size_t begin_patch) {
+    test_cell_();
+    bytes_({ 0x0F, 0x85 });             // jnz body
+    auto at = code_.size();
+    imm32_(0);
+    patch_rel32(at, begin_patch + 4);
+    patch_rel32(begin_patch, code_.size());
+  }
+};
+
+executable::executable(const ir::program& p):
+  code_{ nullptr },
+  size_{ 0 },
+  tape_{ runtime::tape::default_size, ir::max_offset },
+  io_{ } {
+  emitter e;
+  e.prologue();
+  std::vector<std::size_t> loops; // patch offsets of the open loop heads
+  for (std::size_t i = 0; i != p.size(); ++i) {
+    switch (p.ops[i]) {
+      case ir::op_t::add:
+        e.add(p.args[i], p.offsets[i]);
+        break;
+      case ir::op_t::shift:
+        e.shift(p.args[i]);
+        break;
+      case ir::op_t::in:
+        e.in(p.offsets[i]);
+        break;
+      case ir::op_t::out:
+        e.out(p.offsets[i]);
+        break;
+      case ir::op_t::jz:
+        loops.push_back(e.loop_begin());
+        break;
+      case ir::op_t::jnz:
+        e.loop_end(loops.back());
+        loops.pop_back();
+        break;
+      case ir::op_t::clear:
+        e.clear(p.offsets[i]);
+        break;
+      case ir::op_t::mul:
+        e.mul(p.offsets[i], p.args[i]);
+        break;
+      case ir::op_t::scan:
+        e.scan(p.args[i]);
+        break;
+      case ir::op_t::halt:
+        break; // never produced by the front end
+    }
+  }
+  e.epilogue();
+
+  size_ = e.size();
+  code_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (code_ == MAP_FAILED) {
+    code_ = nullptr;
+    throw std::runtime_error{ "could not map memory for generated code" };
+  }
+  std::memcpy(code_, e.data(), size_);
+  // never writable and executable at the same time
+  if (mprotect(code_, size_, PROT_READ | PROT_EXEC) != 0) {
+    munmap(code_, size_);
+    code_ = nullptr;
+    throw std::runtime_error{ "could not make generated code executable" };
+  }
+}
+
+executable::~executable() {
+  if (code_) munmap(code_, size_);
+}
+
+int executable::run() {
+  auto entry  = reinterpret_cast<entry_t>(code_);
+  auto result = entry(tape_.begin(), tape_.size(), &io_);
+  io_.flush();
+  if (result != 0) {
+    std::cerr << "segmentation fault\n";
+  }
+  return result;
+}
+
+#else
+
+executable::executable(const ir::program&):
+  code_{ nullptr },
+  size_{ 0 },
+  tape_{ },
+  io_{ } {
+  throw std::runtime_error{ "jit is not supported on this platform" };
+}
+
+executable::~executable() { }
+
+int executable::run() {
+  return 1;
+}
+
+#endif
+
+} // namespace jit
+
+} // namespace bf
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+
+#include <ir/ir.h>
+#include <runtime/io.h>
+#include <runtime/tape.h>
+
+namespace bf {
+
+namespace jit {
+
+// true when this build can emit and execute native code for the host
+bool supported();
+
+// a program compiled to native x86-64 in an executable mapping. construction
+// throws std::runtime_error when the host isn't supported or the mapping
+// cannot be made
+class executable {
+  void*         code_;
+  std::size_t   size_;
+  runtime::tape tape_;
+  runtime::io   io_;
+public:
+  executable(const ir::program& p);
+  ~executable();
+
+  executable(const executable&)            = delete;
+  executable& operator=(const executable&) = delete;
+
+  // returns 0 on success, non-zero if the program ran off the tape
+  int run();
+};
+
+} // namespace jit
+
+} // namespace bf
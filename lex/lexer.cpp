@@ -1,66 +1,94 @@
 #include <lex/lexer.h>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <lex/scan.h>
+
 namespace bf {
 
 namespace lex {
 
-lexer::lexer(const std::string& filename): 
-  file_{ filename },
-  current_{ '\0' },
-  c_pos_{ } {
-  if (!file_) throw std::ifstream::failure{ "could not open file" };
-
-  c_pos_.name = filename;
+lexer::lexer(const std::string& filename):
+  src_{ filename },
+  name_{ filename },
+  cur_{ src_.begin() },
+  loc_offset_{ 0 },
+  loc_line_{ 1 },
+  loc_line_start_{ 0 } { }
 
-  next_c_();
+token lexer::next_token() {
+  cur_ = find_command(cur_, src_.end());
+  if (cur_ == src_.end()) {
+    return { src_.size(), token_t::eof };
+  }
+  auto offset = static_cast<std::size_t>(cur_ - src_.begin());
+  return { offset, static_cast<token_t>(*cur_++) };
 }
 
-void lexer::next_c_() {
-  update_pos_();
-  current_ = static_cast<char>(file_.get());
-  while (current_ == '\n') {
-    update_pos_();
-    current_ = static_cast<char>(file_.get());
+token_run lexer::next_run() {
+  token_run run{ next_token() };
+  switch (run.type) {
+    case token_t::l_shift:
+    case token_t::r_shift:
+    case token_t::inc:
+    case token_t::dec:
+      // keep the count representable as a signed amount further down the line
+      while (run.count < static_cast<std::uint32_t>(std::numeric_limits<std::int32_t>::max())) {
+        auto next = find_command(cur_, src_.end());
+        if (next == src_.end() || *next != tok_to_c(run.type)) {
+          cur_ = next; // don't scan the comment again for the next token
+          break;
+        }
+        ++run.count;
+        cur_ = next + 1;
+      }
+      break;
+    default:
+      ;
   }
+  return run;
 }
 
-void lexer::update_pos_() {
-  if (file_.eof()) {
-    return;
+position_t lexer::locate(std::size_t offset) const {
+  if (offset < loc_offset_) {
+    // going backwards, start over
+    loc_offset_     = 0;
+    loc_line_       = 1;
+    loc_line_start_ = 0;
   }
 
-  if (current_ == '\n') {
-    ++c_pos_.line;
-    c_pos_.col = 1;
+  auto first = src_.begin() + loc_offset_;
+  auto last  = src_.begin() + offset;
+  auto lines = count_lines(first, last);
+  if (lines != 0) {
+    auto nl = std::find(std::make_reverse_iterator(last), std::make_reverse_iterator(first), '\n');
+    loc_line_      += static_cast<std::uint32_t>(lines);
+    loc_line_start_ = static_cast<std::size_t>(nl.base() - src_.begin()); // one past the '\n'
   }
-  else {
-    ++c_pos_.col;
-  }
-}
+  loc_offset_ = offset;
 
-token lexer::next_token() {
-  while (!file_.eof()) {
-    char c = current_;
-    auto p = c_pos_;
-    next_c_();
+  position_t pos;
+  pos.name = name_;
+  pos.line = loc_line_;
+  pos.col  = static_cast<std::uint32_t>(offset - loc_line_start_ + 1);
+  return pos;
+}
 
-    switch (c) {
-      case tok_to_c(token_t::l_shift):
-      case tok_to_c(token_t::r_shift):
-      case tok_to_c(token_t::inc):
-      case tok_to_c(token_t::dec):
-      case tok_to_c(token_t::out):
-      case tok_to_c(token_t::in):
-      case tok_to_c(token_t::l_bracket):
-      case tok_to_c(token_t::r_bracket):
-        return { p, static_cast<token_t>(c) };
-      default:
-        ;
+std::string lexer::excerpt(std::size_t first, std::size_t last, std::size_t max) const {
+  std::string text;
+  auto end = src_.begin() + std::min(last, src_.size());
+  for (auto c = find_command(src_.begin() + std::min(first, src_.size()), end); c != end; c = find_command(c + 1, end)) {
+    if (text.size() == max) {
+      text += "...";
+      break;
     }
+    text += *c;
   }
-  return { c_pos_, token_t::eof };
+  return text;
 }
 
 } // namespace lex
 
-} // namespace bf
\ No newline at end of file
+} // namespace bf
@@ -1,6 +1,10 @@
 #pragma once
-#include <fstream>
+#include <cstddef>
+#include <cstdint>
 
+#include <string>
+
+#include <lex/source.h>
 #include <lex/token.h>
 
 namespace bf {
@@ -8,17 +12,29 @@ namespace bf {
 namespace lex {
 
 class lexer {
-  std::ifstream file_;
-  char          current_;
-  position_t    c_pos_;
-
-  void next_c_();
-  void update_pos_();
+  source      src_;
+  std::string name_;
+  const char* cur_;
+
+  // locate() resumes counting lines from the last position it resolved, so a
+  // front to back walk over the tokens stays linear
+  mutable std::size_t   loc_offset_;
+  mutable std::uint32_t loc_line_;
+  mutable std::size_t   loc_line_start_;
 public:
   lexer(const std::string& filename);
 
-  const position_t& position() const { return c_pos_; }
+  // the whole source, for front ends that split it up themselves
+  const char* begin() const { return src_.begin(); }
+  const char* end()   const { return src_.end(); }
+
   token next_token();
+  token_run next_run();
+  position_t locate(std::size_t offset) const;
+  position_t locate(const token& tok) const { return locate(tok.offset); }
+  // the commands in [first, last) of the source without the comments around
+  // them, cut off with "..." past max of them
+  std::string excerpt(std::size_t first, std::size_t last, std::size_t max) const;
 };
 
 } // namespace lex
@@ -0,0 +1,102 @@
+#include <lex/scan.h>
+
+#include <algorithm>
+
+#include <lex/token.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define BF_SCAN_X86 1
+#include <immintrin.h>
+#else
+#define BF_SCAN_X86 0
+#endif
+
+namespace bf {
+
+namespace lex {
+
+static bool is_command(char c) {
+  switch (c) {
+    case tok_to_c(token_t::l_shift):
+    case tok_to_c(token_t::r_shift):
+    case tok_to_c(token_t::inc):
+    case tok_to_c(token_t::dec):
+    case tok_to_c(token_t::out):
+    case tok_to_c(token_t::in):
+    case tok_to_c(token_t::l_bracket):
+    case tok_to_c(token_t::r_bracket):
+      return true;
+    default:
+      return false;
+  }
+}
+
+static const char* find_command_scalar(const char* first, const char* last) {
+  return std::find_if(first, last, is_command);
+}
+
+#if BF_SCAN_X86
+
+// mask of the bytes in x that are command characters
+#define BF_COMMAND_MASK(set1, cmpeq, or_, x)                                \
+  or_(or_(or_(cmpeq(x, set1(tok_to_c(token_t::l_shift))),                   \
+              cmpeq(x, set1(tok_to_c(token_t::r_shift)))),                  \
+          or_(cmpeq(x, set1(tok_to_c(token_t::inc))),                       \
+              cmpeq(x, set1(tok_to_c(token_t::dec))))),                     \
+      or_(or_(cmpeq(x, set1(tok_to_c(token_t::out))),                       \
+              cmpeq(x, set1(tok_to_c(token_t::in)))),                       \
+          or_(cmpeq(x, set1(tok_to_c(token_t::l_bracket))),                 \
+              cmpeq(x, set1(tok_to_c(token_t::r_bracket))))))
+
+static const char* find_command_sse2(const char* first, const char* last) {
+  while (last - first >= 16) {
+    auto x    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    auto mask = _mm_movemask_epi8(BF_COMMAND_MASK(_mm_set1_epi8, _mm_cmpeq_epi8, _mm_or_si128, x));
+    if (mask != 0) return first + __builtin_ctz(static_cast<unsigned>(mask));
+    first += 16;
+  }
+  return find_command_scalar(first, last);
+}
+
+__attribute__((target("avx2")))
+static const char* find_command_avx2(const char* first, const char* last) {
+  while (last - first >= 32) {
+    auto x    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+    auto mask = _mm256_movemask_epi8(BF_COMMAND_MASK(_mm256_set1_epi8, _mm256_cmpeq_epi8, _mm256_or_si256, x));
+    if (mask != 0) return first + __builtin_ctz(static_cast<unsigned>(mask));
+    first += 32;
+  }
+  return find_command_sse2(first, last);
+}
+
+#undef BF_COMMAND_MASK
+
+using find_fn = const char* (*)(const char*, const char*);
+
+static find_fn select_find() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") ? find_command_avx2 : find_command_sse2;
+}
+
+static const find_fn find_impl = select_find();
+
+#else
+
+static const auto find_impl = find_command_scalar;
+
+#endif
+
+const char* find_command(const char* first, const char* last) {
+  // real programs are mostly dense runs of commands, don't pay for a vector
+  // load when the very next byte is one
+  if (first != last && is_command(*first)) return first;
+  return find_impl(first, last);
+}
+
+std::size_t count_lines(const char* first, const char* last) {
+  return static_cast<std::size_t>(std::count(first, last, '\n'));
+}
+
+} // namespace lex
+
+} // namespace bf
@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+
+namespace bf {
+
+namespace lex {
+
+// returns the first of the eight command characters in [first, last), or
+// last if there is none. comment runs are skipped 16 or 32 bytes at a time
+// when the host supports SSE2/AVX2
+const char* find_command(const char* first, const char* last);
+
+// the number of '\n' in [first, last)
+std::size_t count_lines(const char* first, const char* last);
+
+} // namespace lex
+
+} // namespace bf
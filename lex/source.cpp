@@ -0,0 +1,58 @@
+#include <lex/source.h>
+
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BF_MMAP_SOURCE 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define BF_MMAP_SOURCE 0
+#endif
+
+namespace bf {
+
+namespace lex {
+
+source::source(const std::string& filename):
+  data_{ nullptr },
+  size_{ 0 } {
+#if BF_MMAP_SOURCE
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw std::ifstream::failure{ "could not open file" };
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    auto mapped = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped != MAP_FAILED) {
+      data_ = static_cast<const char*>(mapped);
+      size_ = static_cast<std::size_t>(st.st_size);
+      madvise(mapped, size_, MADV_SEQUENTIAL);
+      close(fd);
+      return;
+    }
+  }
+  close(fd);
+#endif
+  // empty files, pipes and platforms without mmap
+  std::ifstream file{ filename, std::ios::binary };
+  if (!file) throw std::ifstream::failure{ "could not open file" };
+  buffer_.assign(std::istreambuf_iterator<char>{ file }, std::istreambuf_iterator<char>{ });
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+}
+
+source::~source() {
+#if BF_MMAP_SOURCE
+  if (buffer_.empty() && size_ != 0) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+}
+
+} // namespace lex
+
+} // namespace bf
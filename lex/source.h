@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+
+#include <string>
+#include <vector>
+
+namespace bf {
+
+namespace lex {
+
+// the whole contents of a source file. on POSIX systems the file is mapped
+// read-only rather than copied, elsewhere it is read into memory in one go
+class source {
+  const char*       data_;
+  std::size_t       size_;
+  std::vector<char> buffer_; // only used when the file couldn't be mapped
+public:
+  source(const std::string& filename);
+  ~source();
+
+  source(const source&)            = delete;
+  source& operator=(const source&) = delete;
+
+  const char* begin() const { return data_; }
+  const char* end()   const { return data_ + size_; }
+  std::size_t size()  const { return size_; }
+};
+
+} // namespace lex
+
+} // namespace bf
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 #include <string>
@@ -33,12 +34,14 @@ struct position_t {
   position_t& operator=(position_t&&)      = default;
 };
 
+// tokens only carry their byte offset into the source, the far more
+// expensive position_t is worked out by lexer::locate when a diagnostic needs it
 struct token {
-  position_t pos;
-  token_t    type;
+  std::size_t offset;
+  token_t     type;
 
-  token(position_t pos, token_t type): pos{ std::move(pos) }, type{ type } { }
-  token() : type{ token_t::eof } { }
+  token(std::size_t offset, token_t type): offset{ offset }, type{ type } { }
+  token() : offset{ 0 }, type{ token_t::eof } { }
   token(const token&) = default;
   token(token&&)      = default;
 
@@ -46,6 +49,15 @@ struct token {
   token& operator=(token&&)      = default;
 };
 
+// a run of identical '<', '>', '+' or '-' tokens, possibly with comments in
+// between, starting at offset. every other token comes as a run of one
+struct token_run : token {
+  std::uint32_t count;
+
+  token_run(token tok, std::uint32_t count = 1u): token{ tok }, count{ count } { }
+  token_run() : count{ 0 } { }
+};
+
 } // namespace lex
 
 } // namespace bf
@@ -1,29 +1,49 @@
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <tuple>
 
 #include <code_gen/code_gen.h>
+#include <code_gen/gzip.h>
+#include <interp/interpreter.h>
+#include <interp/profile.h>
+#include <jit/jit.h>
 #include <lex/lexer.h>
-#include <optimize/optimizer.h>
+#include <optimize/pass_manager.h>
 #include <parse/parser.h>
 
 void dump_help(const char **argv);
+void dump_errors(bf::parse::parser& p);
 void dump_tokens(bf::lex::lexer& l);
 void dump_commands(const bf::prog::program& p);
+int compile(bf::code_gen::target_t target, bf::ir::program program, const char* outfile, const bf::code_gen::options& opts);
+int compile_stream(bf::code_gen::target_t target, bf::parse::parser& p, bf::optimize::pass_manager& pm, const char* outfile, const bf::code_gen::options& opts);
 
 int main(int argc, const char* argv[]) {
   enum class mode_t {
     dump_tokens,
     dump_commands,
-    compile
+    compile,
+    run,
+    profile,
+    jit
   } mode = mode_t::compile;
-  bool optimize_ = false;
+  int  level      = -1; // until -O or --optimize picks one
+  bool pass_stats = false;
+  bool stream     = false;
+  auto threads    = std::max(1u, std::thread::hardware_concurrency());
+  auto target     = bf::code_gen::target_t::js;
+  bf::code_gen::options opts;
 
   const char* filename = nullptr;
-  std::string outfile  = "a.html";
+  const char* outfile  = nullptr;
+  const char* passes   = nullptr;
   for (int i = 1; i < argc; ++i) {
     const char* arg = argv[i];
 
@@ -36,8 +56,68 @@ int main(int argc, const char* argv[]) {
     else if (std::strcmp(arg, "--dump-commands") == 0) {
       mode = mode_t::dump_commands;
     }
+    else if (std::strcmp(arg, "--run") == 0) {
+      mode = mode_t::run;
+    }
+    else if (std::strcmp(arg, "--profile") == 0) {
+      mode = mode_t::profile;
+    }
+    else if (std::strcmp(arg, "--jit") == 0) {
+      mode = mode_t::jit;
+    }
     else if (std::strcmp(arg, "--optimize") == 0) {
-      optimize_ = true;
+      level = 2;
+    }
+    else if (arg[0] == '-' && arg[1] == 'O' && arg[2] >= '0' && arg[2] <= '3' && arg[3] == '\0') {
+      level = arg[2] - '0';
+    }
+    else if (std::strncmp(arg, "--passes=", 9) == 0) {
+      passes = arg + 9;
+    }
+    else if (std::strcmp(arg, "--pass-stats") == 0) {
+      pass_stats = true;
+    }
+    else if (std::strncmp(arg, "--threads=", 10) == 0 && std::atoi(arg + 10) > 0) {
+      threads = static_cast<unsigned>(std::atoi(arg + 10));
+    }
+    else if (std::strcmp(arg, "--stream") == 0) {
+      stream = true;
+    }
+    else if (std::strcmp(arg, "--target=js") == 0) {
+      target = bf::code_gen::target_t::js;
+    }
+    else if (std::strcmp(arg, "--target=c") == 0) {
+      target = bf::code_gen::target_t::c;
+    }
+    else if (std::strcmp(arg, "--target=llvm") == 0) {
+      target = bf::code_gen::target_t::llvm;
+    }
+    else if (std::strcmp(arg, "--target=wasm") == 0) {
+      target = bf::code_gen::target_t::wasm;
+    }
+    else if (std::strcmp(arg, "--js-layout=closures") == 0) {
+      opts.js_layout = bf::code_gen::js_layout_t::closures;
+    }
+    else if (std::strcmp(arg, "--js-layout=structured") == 0) {
+      opts.js_layout = bf::code_gen::js_layout_t::structured;
+    }
+    else if (std::strcmp(arg, "--js-layout=worker") == 0) {
+      opts.js_layout = bf::code_gen::js_layout_t::worker;
+    }
+    else if (std::strcmp(arg, "--js-minify") == 0) {
+      opts.js_minify = true;
+    }
+    else if (std::strcmp(arg, "--js-gzip") == 0) {
+      opts.js_gzip = true;
+    }
+    else if (std::strcmp(arg, "--cell-width=8") == 0) {
+      opts.cell_bits = 8;
+    }
+    else if (std::strcmp(arg, "--cell-width=16") == 0) {
+      opts.cell_bits = 16;
+    }
+    else if (std::strcmp(arg, "--cell-width=32") == 0) {
+      opts.cell_bits = 32;
     }
     else if (std::strcmp(arg, "-o") == 0 && i + 1 < argc) {
       outfile = argv[i + 1];
@@ -60,8 +140,54 @@ int main(int argc, const char* argv[]) {
     return 1;
   }
 
+  if (!outfile) {
+    outfile = bf::code_gen::default_outfile(target);
+  }
+
+  // the native tapes are bytes
+  if (opts.cell_bits != 8 && (mode == mode_t::run || mode == mode_t::profile || mode == mode_t::jit || target != bf::code_gen::target_t::js)) {
+    std::cerr << "--cell-width only applies to --target=js\n";
+    return 1;
+  }
+
+  if ((opts.js_minify || opts.js_gzip) && (mode != mode_t::compile || target != bf::code_gen::target_t::js)) {
+    std::cerr << "--js-minify and --js-gzip only apply to --target=js\n";
+    return 1;
+  }
+  if (stream && mode != mode_t::compile) {
+    std::cerr << "--stream only applies when compiling\n";
+    return 1;
+  }
+  if (opts.js_gzip && !bf::code_gen::gzip_supported()) {
+    std::cerr << "--js-gzip needs a build with zlib\n";
+    return 1;
+  }
+
   using namespace bf;
 
+  // the jit works from the optimized program unless told otherwise
+  if (level < 0) {
+    level = mode == mode_t::jit ? 2 : 0;
+  }
+  auto pm = optimize::pass_manager::level(static_cast<unsigned>(level));
+  if (passes) {
+    pm = optimize::pass_manager{ };
+    std::string name;
+    for (const char* c = passes; ; ++c) {
+      if (*c != ',' && *c != '\0') {
+        name += *c;
+        continue;
+      }
+      if (!pm.add(name)) {
+        std::cerr << "unknown pass: " << name << ", expected some of " << optimize::pass_manager::pass_names() << '\n';
+        return 1;
+      }
+      name.clear();
+      if (*c == '\0') break;
+    }
+  }
+  pm.threads(threads);
+
   try {
     lex::lexer l{ filename };
 
@@ -72,32 +198,58 @@ int main(int argc, const char* argv[]) {
 
     parse::parser p{ l };
 
-    auto program = p.parse();
-    if (prog::ill_formed(program)) {
-      for (const auto& e : p.errors()) {
-        std::cerr << e << '\n';
+    if (stream) {
+      auto result = compile_stream(target, p, pm, outfile, opts);
+      if (pass_stats) {
+        optimize::report(std::cerr, pm);
       }
+      return result;
+    }
+
+    auto code = p.parse_ir(threads);
+    if (ir::ill_formed(code)) {
+      dump_errors(p);
       return 1;
     }
 
-    if (optimize_) {
-      optimize::optimize(program);
+    code.cell_bits = opts.cell_bits;
+
+    pm.run(code);
+    if (pass_stats) {
+      optimize::report(std::cerr, pm);
     }
 
     if (mode == mode_t::dump_commands) {
-      dump_commands(program);
+      dump_commands(ir::to_tree(code));
       return 0;
     }
 
-    if (mode == mode_t::compile) {
-      try {
-        code_gen::js_generator gen{ std::move(program), outfile };
-        gen.emit();
-      }
-      catch (const std::exception& e) {
-        std::cerr << "failed to open file: " << outfile << ": " << e.what();
+    if (mode == mode_t::run) {
+      interp::interpreter interp{ std::move(code) };
+      return interp.run();
+    }
+
+    // the report goes to stderr to stay out of the program's output
+    if (mode == mode_t::profile) {
+      interp::interpreter interp{ std::move(code) };
+      std::vector<std::uint64_t> counts;
+      auto start  = std::chrono::steady_clock::now();
+      auto result = interp.run(counts);
+      interp::report(std::cerr, interp.code(), counts, l, std::chrono::duration<double>{ std::chrono::steady_clock::now() - start }.count());
+      return result;
+    }
+
+    if (mode == mode_t::jit) {
+      if (!jit::supported()) {
+        std::cerr << "--jit is not supported on this platform\n";
         return 1;
       }
+      jit::executable exe{ code };
+      return exe.run();
+    }
+
+    if (mode == mode_t::compile) {
+      return compile(target, std::move(code), outfile, opts);
     }
   }
   catch (const std::exception& e) {
@@ -107,10 +259,28 @@ int main(int argc, const char* argv[]) {
 }
 
 void dump_help(const char **argv) {
-  std::cerr << "Usage: " << argv[0] << " [--dump-tokens] [--dump-commands] [--optimize] [-o outfile] [-h help]"
+  std::cerr << "Usage: " << argv[0] << " [--dump-tokens] [--dump-commands] [--run] [--profile] [--jit] [--optimize] [-O0|-O1|-O2|-O3] [--passes=pass,...] [--pass-stats] [--stream] [--threads=n] [--target=js|c|llvm|wasm] [--js-layout=closures|structured|worker] [--cell-width=8|16|32] [--js-minify] [--js-gzip] [-o outfile] [-h help]"
             << " brainfuck_file" << std::endl;
 }
 
+int compile(bf::code_gen::target_t target, bf::ir::program program, const char* outfile, const bf::code_gen::options& opts) {
+  try {
+    auto gen = bf::code_gen::make_generator(target, std::move(program), outfile, opts);
+    gen->emit();
+  }
+  catch (const std::exception& e) {
+    std::cerr << "failed to open file: " << outfile << ": " << e.what();
+    return 1;
+  }
+  return 0;
+}
+
+void dump_errors(bf::parse::parser& p) {
+  for (const auto& e : p.errors()) {
+    std::cerr << e << '\n';
+  }
+}
+
 void dump_tokens(bf::lex::lexer& l) {
   auto tok = l.next_token();
 
@@ -128,7 +298,8 @@ void dump_tokens(bf::lex::lexer& l) {
   };
 
   while (tok.type != bf::lex::token_t::eof) {
-    tokens.emplace_back("'"s + bf::lex::tok_to_c(tok.type) + "'"s, std::to_string(tok.pos.line), std::to_string(tok.pos.col));
+    auto pos = l.locate(tok);
+    tokens.emplace_back("'"s + bf::lex::tok_to_c(tok.type) + "'"s, std::to_string(pos.line), std::to_string(pos.col));
     tok = l.next_token();
 
     longest[0] = std::max(longest[0], std::get<0>(tokens.back()).size());
@@ -158,8 +329,11 @@ void dump_tokens(bf::lex::lexer& l) {
 }
 
 #include <cmd/arithmetic.h>
+#include <cmd/clear.h>
 #include <cmd/io.h>
 #include <cmd/loop.h>
+#include <cmd/multiply.h>
+#include <cmd/scan.h>
 #include <cmd/shift.h>
 
 void dump_command(const bf::cmd::command& c, std::size_t indent) {
@@ -169,11 +343,22 @@ void dump_command(const bf::cmd::command& c, std::size_t indent) {
     std::size_t indent;
     print_visitor(std::size_t indent) : indent{ indent } { }
 
+    // only commands moved off the current cell have one worth printing
+    static void print_offset(std::int32_t offset) {
+      if (offset != 0) std::cout << " offset{" << offset << "}";
+    }
+
     void operator()(const bf::cmd::arithmetic& a) const override {
       std::cout << "arithmetic: type{" << (a.type == bf::cmd::arithmetic::arith_type::add ? "add" : "subtract") << "} amount{" << a.amount << "}";
+      print_offset(a.offset);
+    }
+    void operator()(const bf::cmd::clear& c) const override {
+      std::cout << "clear";
+      print_offset(c.offset);
     }
     void operator()(const bf::cmd::io& io) const override {
       std::cout << "I/O: type{" << (io.type == bf::cmd::io::io_type::in ? "input" : "output") << "}";
+      print_offset(io.offset);
     }
     void operator()(const bf::cmd::loop& l) const override {
       std::cout << "loop: {\n";
@@ -184,6 +369,12 @@ void dump_command(const bf::cmd::command& c, std::size_t indent) {
       for (std::size_t i = 0; i < indent; ++i) std::cout << ' ';
       std::cout << "}";
     }
+    void operator()(const bf::cmd::multiply& m) const override {
+      std::cout << "multiply: offset{" << m.offset << "} factor{" << m.factor << "}";
+    }
+    void operator()(const bf::cmd::scan& s) const override {
+      std::cout << "scan: type{" << (s.type == bf::cmd::scan::scan_type::left ? "left" : "right") << "} stride{" << s.stride << "}";
+    }
     void operator()(const bf::cmd::shift& s) const override {
       std::cout << "shift: type{" << (s.type == bf::cmd::shift::shift_type::left ? "left" : "right") << "} amount{" << s.amount << "}";
     }
@@ -197,3 +388,42 @@ void dump_commands(const bf::prog::program& p) {
     std::cout.put('\n');
   }
 }
+
+// translates the program a part at a time as it is parsed, so that memory
+// holds no more than the part at hand rather than the whole program
+int compile_stream(bf::code_gen::target_t target, bf::parse::parser& p, bf::optimize::pass_manager& pm, const char* outfile, const bf::code_gen::options& opts) {
+  // large enough that the optimizer rarely sees a part end where it could
+  // have carried on
+  constexpr std::size_t part_size = 1 << 16;
+
+  try {
+    auto gen = bf::code_gen::make_stream_generator(target, outfile, opts);
+    if (!gen) {
+      std::cerr << "--stream does not support this target, the wasm target and the structured and worker js layouts need the whole program\n";
+      return 1;
+    }
+
+    gen->begin();
+    bf::ir::program part;
+    bool any = false;
+    while (p.parse_ir_part(part, part_size)) {
+      part.cell_bits = opts.cell_bits;
+      pm.run(part);
+      gen->emit_part(part);
+      any = true;
+    }
+    if (!any || !p.errors().empty()) {
+      // an ill-formed program, what was written of it is of no use
+      gen.reset();
+      std::remove(outfile);
+      dump_errors(p);
+      return 1;
+    }
+    gen->end();
+  }
+  catch (const std::exception& e) {
+    std::cerr << "failed to open file: " << outfile << ": " << e.what();
+    return 1;
+  }
+  return 0;
+}
@@ -1,11 +1,16 @@
 #include <optimize/folder.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
 
 #include <cmd/arithmetic.h>
+#include <cmd/clear.h>
 #include <cmd/io.h>
 #include <cmd/loop.h>
+#include <cmd/multiply.h>
+#include <cmd/scan.h>
 #include <cmd/shift.h>
 
 namespace bf {
@@ -18,8 +23,11 @@ struct base_is_visitor : cmd::command::visitor {
 
   // stubs
   void operator()(const cmd::arithmetic&) const override { }
+  void operator()(const cmd::clear&)      const override { }
   void operator()(const cmd::io&)         const override { }
   void operator()(const cmd::loop&)       const override { }
+  void operator()(const cmd::multiply&)   const override { }
+  void operator()(const cmd::scan&)       const override { }
   void operator()(const cmd::shift&)      const override { }
 };
 template <typename T, typename = std::enable_if_t<std::is_base_of<cmd::command, T>::value>>
@@ -37,19 +45,20 @@ bool is(const cmd::command& c) {
   return *is_.result;
 }
 
-static std::shared_ptr<cmd::loop> fold_loop(const cmd::loop& l);
+static const cmd::loop* fold_loop(const cmd::loop& l, cmd::arena& arena);
 
 template <typename I>
 struct folding_visitor : cmd::command::visitor {
-  I* first;
-  I* last;
+  I*          first;
+  I*          last;
+  cmd::arena* arena;
 
-  folding_visitor(I& first, I& last):
-    first{ &first }, last{ &last } { }
+  folding_visitor(I& first, I& last, cmd::arena& arena):
+    first{ &first }, last{ &last }, arena{ &arena } { }
 
-  void operator()(const cmd::arithmetic&) const override {
-    auto arith_end = std::find_if(*first, *last, [](const auto& c) {
-      return !is<cmd::arithmetic>(*c);
+  void operator()(const cmd::arithmetic& a) const override {
+    auto arith_end = std::find_if(*first, *last, [&](const auto& c) {
+      return !is<cmd::arithmetic>(*c) || static_cast<const cmd::arithmetic&>(*c).offset != a.offset;
     });
     // if the sequence is a single instruction, skip it, no folding can be done
     if (std::distance(*first, arith_end) <= 1) {
@@ -72,19 +81,31 @@ struct folding_visitor : cmd::command::visitor {
     // remove others
     *last = std::rotate(*first, --arith_end, *last);
     if (total_amount < 0) {
-      **first = std::make_shared<cmd::arithmetic>(cmd::arithmetic::arith_type::sub, static_cast<std::uint32_t>(-total_amount));
+      **first = arena->make<cmd::arithmetic>(cmd::arithmetic::arith_type::sub, static_cast<std::uint32_t>(-total_amount), a.offset);
     }
     else {
-      **first = std::make_shared<cmd::arithmetic>(cmd::arithmetic::arith_type::add, static_cast<std::uint32_t>(total_amount));
+      **first = arena->make<cmd::arithmetic>(cmd::arithmetic::arith_type::add, static_cast<std::uint32_t>(total_amount), a.offset);
     }
     ++*first;
   }
+  void operator()(const cmd::clear&) const override {
+    // no transformation
+    ++*first;
+  }
   void operator()(const cmd::io&) const override {
     // no transformation
     ++*first;
   }
+  void operator()(const cmd::multiply&) const override {
+    // no transformation
+    ++*first;
+  }
+  void operator()(const cmd::scan&) const override {
+    // no transformation
+    ++*first;
+  }
   void operator()(const cmd::loop& l) const override {
-    auto loop_optimized = fold_loop(l);
+    auto loop_optimized = fold_loop(l, *arena);
     if (loop_optimized->statements.empty()) {
       // throw away this loop object
       if (*first + 1 != *last) {
@@ -95,7 +116,7 @@ struct folding_visitor : cmd::command::visitor {
       }
       return;
     }
-    **first = std::move(loop_optimized);
+    **first = loop_optimized;
     ++*first;
   }
   void operator()(const cmd::shift&) const override {
@@ -123,25 +144,24 @@ struct folding_visitor : cmd::command::visitor {
     // remove others
     *last = std::rotate(*first, --shift_end, *last);
     if (total_amount < 0) {
-      **first = std::make_shared<cmd::shift>(cmd::shift::shift_type::left, static_cast<std::uint32_t>(-total_amount));
+      **first = arena->make<cmd::shift>(cmd::shift::shift_type::left, static_cast<std::uint32_t>(-total_amount));
     }
     else {
-      **first = std::make_shared<cmd::shift>(cmd::shift::shift_type::right, static_cast<std::uint32_t>(total_amount));
+      **first = arena->make<cmd::shift>(cmd::shift::shift_type::right, static_cast<std::uint32_t>(total_amount));
     }
     ++*first;
   }
 };
 
-static std::shared_ptr<cmd::loop> fold_loop(const cmd::loop& l) {
-  auto cmds  = l.statements;
+static const cmd::loop* fold_loop(const cmd::loop& l, cmd::arena& arena) {
+  std::vector<const cmd::command*> cmds(std::begin(l.statements), std::end(l.statements));
   auto first = std::begin(cmds);
   auto last  = std::end(cmds);
   while (first != last) {
-    folding_visitor<cmd::loop::cmd_list_t::iterator> fv{ first, last };
+    folding_visitor<std::vector<const cmd::command*>::iterator> fv{ first, last, arena };
     (*first)->accept(fv);
   }
-  cmds.erase(last, std::end(cmds));
-  return std::make_shared<cmd::loop>(std::move(cmds));
+  return arena.make<cmd::loop>(arena.copy(cmds.data(), static_cast<std::size_t>(last - std::begin(cmds))));
 }
 
 void fold(prog::program& p) {
@@ -149,12 +169,79 @@ void fold(prog::program& p) {
   auto first = std::begin(p);
   auto last  = std::end(p);
   while (first != last) {
-    folding_visitor<prog::program::iterator> fv{ first, last };
+    folding_visitor<prog::program::iterator> fv{ first, last, p.arena() };
     (*first)->accept(fv); // this will update [first, last)
   }
   p.erase(last, std::end(p)); // remove entries that were eliminated
 }
 
+// whether a sum of two args is an arg itself
+static bool fits(std::int64_t sum) {
+  return sum >= std::numeric_limits<std::int32_t>::min() && sum <= std::numeric_limits<std::int32_t>::max();
+}
+
+void fold(ir::program& p) {
+  // compact the program in place, out is the next slot to write. runs of
+  // arithmetic or shifts are merged into the instruction that started them.
+  // adds wrap like the cells do, a run of shifts too long for an arg is left
+  // in pieces
+  std::size_t out = 0;
+  std::vector<std::size_t> heads;
+  for (std::size_t i = 0; i != p.size(); ++i) {
+    auto op     = p.ops[i];
+    auto arg    = p.args[i];
+    auto origin = p.origins[i];
+    switch (op) {
+      case ir::op_t::add:
+      case ir::op_t::shift:
+        if (out != 0 && p.ops[out - 1] == op && p.offsets[out - 1] == p.offsets[i]) {
+          auto sum = std::int64_t{ arg } + p.args[out - 1];
+          if (op == ir::op_t::add || fits(sum)) {
+            arg    = static_cast<std::int32_t>(static_cast<std::uint32_t>(sum));
+            origin = p.origins[--out]; // the run starts there
+          }
+        }
+        if (op == ir::op_t::add) {
+          arg = ir::wrap(p, arg);
+        }
+        if (arg == 0) {
+          continue; // no meaningful math happening
+        }
+        break;
+      case ir::op_t::jz:
+        heads.push_back(out);
+        break;
+      case ir::op_t::jnz:
+        {
+          auto head = heads.back();
+          heads.pop_back();
+          if (head + 1 == out) {
+            // throw away empty loops
+            out = head;
+            continue;
+          }
+          p.jumps[head] = static_cast<std::uint32_t>(out);
+          p.jumps[i]    = static_cast<std::uint32_t>(head);
+        }
+        break;
+      case ir::op_t::in:
+      case ir::op_t::out:
+      case ir::op_t::clear:
+      case ir::op_t::mul:
+      case ir::op_t::scan:
+      case ir::op_t::halt:
+        break;
+    }
+    p.ops[out]     = op;
+    p.args[out]    = arg;
+    p.offsets[out] = p.offsets[i];
+    p.jumps[out]   = p.jumps[i];
+    p.origins[out] = origin;
+    ++out;
+  }
+  p.resize(out);
+}
+
 } // namespace optimize
 
 } // namespace bf
\ No newline at end of file
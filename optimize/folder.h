@@ -1,11 +1,13 @@
 #pragma once
 #include <cmd/program.h>
+#include <ir/ir.h>
 
 namespace bf {
 
 namespace optimize {
 
 void fold(prog::program& p);
+void fold(ir::program& p);
 
 } // namespace optimize
 
@@ -0,0 +1,124 @@
+#include <optimize/idioms.h>
+
+#include <cstdint>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace bf {
+
+namespace optimize {
+
+struct instruction {
+  ir::op_t     op;
+  std::int32_t arg;
+  std::int32_t offset;
+};
+
+// walks every loop and lets match replace it. match is handed the body
+// [first, last) and fills with the instructions to put in the loop's place,
+// returning false to leave the loop alone. the program is compacted in place,
+// which works because no replacement is longer than the loop it replaces
+template <typename Match>
+static void rewrite_loops(ir::program& p, Match match) {
+  std::vector<instruction> with;
+  std::size_t out = 0;
+  std::size_t i   = 0;
+  while (i != p.size()) {
+    if (p.ops[i] == ir::op_t::jz) {
+      auto tail = p.jumps[i];
+      with.clear();
+      if (match(p, i + 1, static_cast<std::size_t>(tail), with)) {
+        auto origin = p.origins[i]; // the replacement stands for the whole loop
+        for (const auto& w : with) {
+          p.ops[out]     = w.op;
+          p.args[out]    = w.arg;
+          p.offsets[out] = w.offset;
+          p.origins[out] = origin;
+          ++out;
+        }
+        i = tail + 1;
+        continue;
+      }
+    }
+    p.move(i++, out++);
+  }
+  p.resize(out);
+  ir::relink(p);
+}
+
+void clear_loops(ir::program& p) {
+  rewrite_loops(p, [](const ir::program& code, std::size_t first, std::size_t last, std::vector<instruction>& with) {
+    if (last - first != 1 || code.ops[first] != ir::op_t::add || code.offsets[first] != 0) return false;
+    // an odd step visits every value mod 256, so the loop always ends on zero.
+    // an even one may spin forever, keep that behavior
+    if ((code.args[first] & 1) == 0) return false;
+    with.push_back({ ir::op_t::clear, 0, 0 });
+    return true;
+  });
+}
+
+// whether a sum of args is an arg itself
+static bool fits(std::int64_t sum) {
+  return sum >= std::numeric_limits<std::int32_t>::min() && sum <= std::numeric_limits<std::int32_t>::max();
+}
+
+void multiply_loops(ir::program& p) {
+  // summed in 64 bits so no body can overflow them, a loop whose sums don't
+  // fit an arg is left alone
+  std::vector<std::pair<std::int64_t, std::int64_t>> deltas; // offset, amount
+  rewrite_loops(p, [&](const ir::program& code, std::size_t first, std::size_t last, std::vector<instruction>& with) {
+    deltas.clear();
+    std::int64_t pos = 0;
+    for (auto i = first; i != last; ++i) {
+      switch (code.ops[i]) {
+        case ir::op_t::add:
+          {
+            auto at = pos + code.offsets[i];
+            auto it = std::find_if(std::begin(deltas), std::end(deltas), [&](const auto& d) { return d.first == at; });
+            if (it == std::end(deltas)) deltas.emplace_back(at, code.args[i]);
+            else                        it->second += code.args[i];
+          }
+          break;
+        case ir::op_t::shift:
+          pos += code.args[i];
+          break;
+        default:
+          return false; // I/O or a nested loop
+      }
+    }
+    if (pos != 0) return false;
+    for (const auto& d : deltas) {
+      if (!fits(d.first) || !fits(d.second)) return false;
+    }
+
+    auto counter = std::find_if(std::begin(deltas), std::end(deltas), [](const auto& d) { return d.first == 0; });
+    if (counter == std::end(deltas)) return false;
+    auto step = ir::wrap(code, static_cast<std::int32_t>(counter->second));
+    if (step != 1 && step != -1) return false;
+
+    // counting down runs *p times, counting up runs 256 - *p times which is
+    // the same as -*p
+    for (const auto& d : deltas) {
+      auto factor = ir::wrap(code, static_cast<std::int32_t>(step == -1 ? d.second : -d.second));
+      if (d.first == 0 || factor == 0) continue;
+      with.push_back({ ir::op_t::mul, factor, static_cast<std::int32_t>(d.first) });
+    }
+    with.push_back({ ir::op_t::clear, 0, 0 });
+    return true;
+  });
+}
+
+void scan_loops(ir::program& p) {
+  rewrite_loops(p, [](const ir::program& code, std::size_t first, std::size_t last, std::vector<instruction>& with) {
+    if (last - first != 1 || code.ops[first] != ir::op_t::shift) return false;
+    with.push_back({ ir::op_t::scan, code.args[first], 0 });
+    return true;
+  });
+}
+
+} // namespace optimize
+
+} // namespace bf
@@ -0,0 +1,22 @@
+#pragma once
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace optimize {
+
+// [-], [+] and any other loop adding an odd amount to the current cell become
+// a single clear
+void clear_loops(ir::program& p);
+
+// loops that only do arithmetic, return to where they started and step the
+// current cell by one, e.g. [->+>++<<], become a multiply per target cell
+// followed by a clear
+void multiply_loops(ir::program& p);
+
+// [>], [<<] and the like become a scan for the next zero cell
+void scan_loops(ir::program& p);
+
+} // namespace optimize
+
+} // namespace bf
@@ -0,0 +1,105 @@
+#include <optimize/offsets.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <limits>
+
+namespace bf {
+
+namespace optimize {
+
+// how far back an add looks for an earlier add to the same cell to merge with.
+// keeps huge straight-line blocks from going quadratic
+constexpr std::size_t merge_window = 32;
+
+static bool touches(const ir::program& p, std::size_t i, std::int32_t offset) {
+  switch (p.ops[i]) {
+    case ir::op_t::in:
+    case ir::op_t::out:
+    case ir::op_t::clear:
+      return p.offsets[i] == offset;
+    default:
+      return false;
+  }
+}
+
+void defer_shifts(ir::program& p) {
+  // compact the program in place, out is the next slot to write. every shift
+  // written out stands for at least one shift that was dropped, so the output
+  // never outgrows the input
+  std::size_t   out   = 0;
+  std::size_t   block = 0; // first instruction of the current block in the output
+  std::int32_t  pos   = 0; // pointer movement not yet materialized
+  std::uint32_t moved = 0; // origin of the last shift folded into pos
+  auto flush = [&]() {
+    if (pos == 0) return;
+    p.ops[out]     = ir::op_t::shift;
+    p.args[out]    = pos;
+    p.offsets[out] = 0;
+    p.origins[out] = moved;
+    ++out;
+    pos   = 0;
+    block = out; // offsets after this are from a different p
+  };
+  for (std::size_t i = 0; i != p.size(); ++i) {
+    switch (p.ops[i]) {
+      case ir::op_t::shift:
+        // pos is within max_offset here, so only an arg near the limits can
+        // take the sum out of range. it then starts a movement of its own
+        if (std::abs(std::int64_t{ pos } + p.args[i]) > std::numeric_limits<std::int32_t>::max()) flush();
+        pos  += p.args[i];
+        moved = p.origins[i];
+        if (std::abs(std::int64_t{ pos }) > ir::max_offset) flush();
+        continue;
+      case ir::op_t::add:
+      case ir::op_t::in:
+      case ir::op_t::out:
+      case ir::op_t::clear:
+        if (std::abs(pos + p.offsets[i]) > ir::max_offset) flush();
+        p.move(i, out);
+        p.offsets[out] += pos;
+        if (p.ops[out] == ir::op_t::add) {
+          // fold into an earlier add of the same cell if nothing in between
+          // looks at it
+          auto offset = p.offsets[out];
+          auto stop   = out - block > merge_window ? out - merge_window : block;
+          for (auto j = out; j-- != stop;) {
+            if (p.ops[j] == ir::op_t::add && p.offsets[j] == offset) {
+              auto sum  = std::int64_t{ p.args[j] } + p.args[out];
+              p.args[j] = ir::wrap(p, static_cast<std::int32_t>(static_cast<std::uint32_t>(sum)));
+              --out;
+              break;
+            }
+            if (touches(p, j, offset)) break;
+          }
+        }
+        ++out;
+        continue;
+      case ir::op_t::jz:
+      case ir::op_t::jnz:
+      case ir::op_t::mul:  // reads *p
+      case ir::op_t::scan: // moves p by a distance only known at run time
+      case ir::op_t::halt:
+        flush();
+        p.move(i, out++);
+        block = out;
+        continue;
+    }
+  }
+  flush();
+  p.resize(out);
+
+  // merging may have left adds of nothing behind
+  out = 0;
+  for (std::size_t i = 0; i != p.size(); ++i) {
+    if (p.ops[i] == ir::op_t::add && p.args[i] == 0) continue;
+    p.move(i, out++);
+  }
+  p.resize(out);
+  ir::relink(p);
+}
+
+} // namespace optimize
+
+} // namespace bf
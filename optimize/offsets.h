@@ -0,0 +1,16 @@
+#pragma once
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace optimize {
+
+// sinks pointer movement to the end of each straight-line block. the adds,
+// I/O and clears in between address their cell as an offset from where the
+// block started, e.g. >+>++<<- becomes p[1] += 1, p[2] += 2, p[0] -= 1 with
+// the shifts cancelling out entirely
+void defer_shifts(ir::program& p);
+
+} // namespace optimize
+
+} // namespace bf
@@ -1,6 +1,7 @@
 #include <optimize/optimizer.h>
 
 #include <optimize/folder.h>
+#include <optimize/pass_manager.h>
 
 namespace bf {
 
@@ -10,6 +11,10 @@ void optimize(prog::program& p) {
   fold(p);
 }
 
+void optimize(ir::program& p) {
+  pass_manager::level(2).run(p);
+}
+
 } // namespace optimize
 
 } // namespace bf
\ No newline at end of file
@@ -1,11 +1,14 @@
 #pragma once
 #include <cmd/program.h>
+#include <ir/ir.h>
 
 namespace bf {
 
 namespace optimize {
 
 void optimize(prog::program& p);
+// the -O2 pipeline, see pass_manager for the others
+void optimize(ir::program& p);
 
 } // namespace optimize
 
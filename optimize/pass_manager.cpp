@@ -0,0 +1,193 @@
+#include <optimize/pass_manager.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+#include <optimize/folder.h>
+#include <optimize/idioms.h>
+#include <optimize/offsets.h>
+#include <optimize/scheduler.h>
+
+namespace bf {
+
+namespace optimize {
+
+// how many times a fixpoint pipeline may run, each round has to shrink the
+// program so this only bounds pathological inputs
+constexpr unsigned max_rounds = 8;
+
+struct named_pass {
+  const char*            name;
+  pass_manager::pass_fn  fn;
+};
+
+// in the order level 2 runs them
+static const named_pass known_passes[] = {
+  { "fold",   static_cast<void (*)(ir::program&)>(fold) },
+  { "clear",  clear_loops },
+  { "mul",    multiply_loops },
+  { "scan",   scan_loops },
+  { "offset", defer_shifts }
+};
+
+pass_manager pass_manager::level(unsigned n) {
+  pass_manager pm;
+  if (n >= 1) pm.add("fold");
+  if (n >= 2) {
+    pm.add("clear");
+    pm.add("mul");
+    pm.add("scan");
+    pm.add("offset");
+  }
+  pm.fixpoint(n >= 3);
+  return pm;
+}
+
+const char* pass_manager::pass_names() {
+  return "fold,clear,mul,scan,offset";
+}
+
+bool pass_manager::add(const std::string& name) {
+  for (const auto& pass : known_passes) {
+    if (name == pass.name) {
+      passes_.push_back(pass.fn);
+      stats_.push_back({ pass.name });
+      return true;
+    }
+  }
+  return false;
+}
+
+// parts of a program up to this size are optimized on one thread, beyond it
+// a part is cut into ranges of at most this size that are optimized apart
+constexpr std::size_t serial_cutoff = 1 << 14;
+
+// a range of whole statements of a program, or a bracket of a loop too large
+// to be optimized in one go
+struct range {
+  std::size_t first;
+  std::size_t last;
+  bool        bracket;
+};
+
+// cuts [first, last) into ranges of at most serial_cutoff instructions,
+// going into the loops too large for one. the passes only look within loops
+// and runs of straight code, so ranges can be optimized independently
+static void cut(const ir::program& p, std::size_t first, std::size_t last, std::vector<range>& ranges) {
+  auto start = first;
+  for (auto i = first; i != last;) {
+    auto next = p.ops[i] == ir::op_t::jz ? p.jumps[i] + std::size_t{ 1 } : i + 1;
+    if (next - i > serial_cutoff) {
+      if (start != i) ranges.push_back({ start, i, false });
+      ranges.push_back({ i, i + 1, true });
+      cut(p, i + 1, next - 1, ranges);
+      ranges.push_back({ next - 1, next, true });
+      start = next;
+    }
+    else if (next - start > serial_cutoff) {
+      ranges.push_back({ start, i, false });
+      start = i;
+    }
+    i = next;
+  }
+  if (start != last) ranges.push_back({ start, last, false });
+}
+
+void pass_manager::run(ir::program& p) {
+  if (threads_ > 1 && p.size() > serial_cutoff && !passes_.empty()) {
+    run_parallel_(p);
+    return;
+  }
+  run_(p, stats_);
+}
+
+void pass_manager::run_(ir::program& p, std::vector<pass_stats>& stats) const {
+  for (unsigned round = 0; round != max_rounds; ++round) {
+    auto start_size = p.size();
+    for (std::size_t i = 0; i != passes_.size(); ++i) {
+      auto& s     = stats[i];
+      auto before = p.size();
+      ++s.runs;
+      if (round == 0) s.before += before;
+
+      auto start = std::chrono::steady_clock::now();
+      passes_[i](p);
+      s.seconds += std::chrono::duration<double>{ std::chrono::steady_clock::now() - start }.count();
+      s.delta   += static_cast<std::int64_t>(p.size()) - static_cast<std::int64_t>(before);
+    }
+    if (!fixpoint_ || p.size() >= start_size) break;
+  }
+}
+
+void pass_manager::run_parallel_(ir::program& p) {
+  std::vector<range> ranges;
+  cut(p, 0, p.size(), ranges);
+
+  // every range is copied out, optimized with stats of its own and put back
+  std::vector<ir::program>             parts(ranges.size());
+  std::vector<std::vector<pass_stats>> part_stats(ranges.size());
+  run_tasks(ranges.size(), threads_, [&](std::size_t r) {
+    auto& part = parts[r];
+    part.cell_bits = p.cell_bits;
+    part.resize(ranges[r].last - ranges[r].first);
+    for (std::size_t i = 0; i != part.size(); ++i) {
+      auto from = ranges[r].first + i;
+      part.ops[i]     = p.ops[from];
+      part.args[i]    = p.args[from];
+      part.offsets[i] = p.offsets[from];
+      part.origins[i] = p.origins[from];
+    }
+    if (ranges[r].bracket) return;
+
+    ir::relink(part);
+    for (const auto& s : stats_) {
+      part_stats[r].push_back({ s.name });
+    }
+    run_(part, part_stats[r]);
+  });
+
+  p.resize(0);
+  for (const auto& part : parts) {
+    for (std::size_t i = 0; i != part.size(); ++i) {
+      p.push(part.ops[i], part.args[i], part.offsets[i], part.origins[i]);
+    }
+  }
+  ir::relink(p);
+
+  // the runs of a pass are counted once per round like on one thread, its
+  // time is the time all threads spent in it
+  for (std::size_t i = 0; i != stats_.size(); ++i) {
+    std::size_t runs = 0;
+    for (const auto& ps : part_stats) {
+      if (ps.empty()) continue;
+      runs              = std::max(runs, ps[i].runs);
+      stats_[i].seconds += ps[i].seconds;
+      stats_[i].before  += ps[i].before;
+      stats_[i].delta   += ps[i].delta;
+    }
+    stats_[i].runs += runs;
+  }
+}
+
+void report(std::ostream& os, const pass_manager& pm) {
+  auto flags = os.flags();
+  os << std::left << std::setw(8) << "pass" << std::right
+     << std::setw(6)  << "runs"
+     << std::setw(12) << "time (ms)"
+     << std::setw(14) << "before"
+     << std::setw(14) << "delta" << '\n';
+  os << std::fixed << std::setprecision(3);
+  for (const auto& s : pm.stats()) {
+    os << std::left << std::setw(8) << s.name << std::right
+       << std::setw(6)  << s.runs
+       << std::setw(12) << s.seconds * 1000
+       << std::setw(14) << s.before
+       << std::setw(14) << std::showpos << s.delta << std::noshowpos << '\n';
+  }
+  os.flags(flags);
+}
+
+} // namespace optimize
+
+} // namespace bf
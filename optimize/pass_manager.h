@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace optimize {
+
+// what one pass of the pipeline did, summed over every run() so far
+struct pass_stats {
+  const char*  name;
+  std::size_t  runs    = 0; // more than one when iterating to a fixpoint
+  double       seconds = 0; // summed over the threads when optimizing in parallel
+  std::size_t  before  = 0; // instructions going into its first run of each run()
+  std::int64_t delta   = 0; // instructions it added, negative when it removed them
+};
+
+// runs a pipeline of ir passes in order, optionally repeating the whole
+// pipeline until a round no longer shrinks the program
+class pass_manager {
+public:
+  using pass_fn = void (*)(ir::program&);
+private:
+  std::vector<pass_fn>    passes_;
+  std::vector<pass_stats> stats_;
+  bool                    fixpoint_ = false;
+  unsigned                threads_  = 1;
+
+  void run_(ir::program& p, std::vector<pass_stats>& stats) const;
+  void run_parallel_(ir::program& p);
+public:
+  // the highest level level() knows, anything above it is treated as it
+  static constexpr unsigned max_level = 3;
+
+  // 0 runs nothing, 1 folds, 2 adds the loop idioms and shift deferral and
+  // 3 repeats that until it stops paying off
+  static pass_manager level(unsigned n);
+  // the names add() accepts, comma separated in pipeline order of level 2
+  static const char* pass_names();
+
+  // appends the pass called name, returns false if there is no such pass
+  bool add(const std::string& name);
+  void fixpoint(bool on) { fixpoint_ = on; }
+  // large programs are cut into pieces that are optimized on up to n threads
+  void threads(unsigned n) { threads_ = n; }
+  bool empty() const { return passes_.empty(); }
+
+  // a program fed in parts is run once per part
+  void run(ir::program& p);
+
+  const std::vector<pass_stats>& stats() const { return stats_; }
+};
+
+// a table of the stats pm has gathered over its runs
+void report(std::ostream& os, const pass_manager& pm);
+
+} // namespace optimize
+
+} // namespace bf
@@ -0,0 +1,100 @@
+#include <optimize/scheduler.h>
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bf {
+
+namespace optimize {
+
+namespace {
+
+// the indices a thread has yet to run. the owner takes from the front,
+// thieves from the back
+struct share {
+  std::mutex  lock;
+  std::size_t first = 0;
+  std::size_t last  = 0;
+};
+
+} // namespace
+
+void run_tasks(std::size_t n, unsigned threads, const std::function<void(std::size_t)>& task) {
+  auto count = std::max<std::size_t>(1, std::min<std::size_t>(threads, n));
+  if (count == 1) {
+    for (std::size_t i = 0; i != n; ++i) task(i);
+    return;
+  }
+
+  std::vector<share> shares(count);
+  for (std::size_t w = 0; w != count; ++w) {
+    shares[w].first = n * w / count;
+    shares[w].last  = n * (w + 1) / count;
+  }
+
+  std::mutex         error_lock;
+  std::exception_ptr error;
+
+  auto work = [&](std::size_t w) {
+    auto& own = shares[w];
+    for (;;) {
+      std::size_t i;
+      bool        have = false;
+      {
+        std::lock_guard<std::mutex> guard{ own.lock };
+        if (own.first != own.last) {
+          i    = own.first++;
+          have = true;
+        }
+      }
+      if (have) {
+        try {
+          task(i);
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> guard{ error_lock };
+          if (!error) error = std::current_exception();
+        }
+        continue;
+      }
+
+      // steal from the others, starting with the next thread over. once
+      // they are all empty nothing is left, tasks never make new ones
+      bool stole = false;
+      for (std::size_t v = (w + 1) % count; v != w && !stole; v = (v + 1) % count) {
+        auto& victim = shares[v];
+        std::size_t first, last;
+        {
+          std::lock_guard<std::mutex> guard{ victim.lock };
+          auto left = victim.last - victim.first;
+          if (left == 0) continue;
+          last         = victim.last;
+          victim.last -= (left + 1) / 2;
+          first        = victim.last;
+        }
+        std::lock_guard<std::mutex> guard{ own.lock };
+        own.first = first;
+        own.last  = last;
+        stole     = true;
+      }
+      if (!stole) return;
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (std::size_t w = 1; w != count; ++w) {
+    pool.emplace_back(work, w);
+  }
+  work(0);
+  for (auto& t : pool) {
+    t.join();
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+} // namespace optimize
+
+} // namespace bf
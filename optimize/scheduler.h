@@ -0,0 +1,20 @@
+#pragma once
+#include <cstddef>
+
+#include <functional>
+
+namespace bf {
+
+namespace optimize {
+
+// runs task(i) for every i in [0, n) on up to threads threads, the calling
+// one among them. every thread starts on an even share of the indices and
+// works through it front to back. one that runs out steals the back half of
+// what another has left, so threads that drew cheap tasks help out with the
+// expensive ones. if a task throws, the first exception is rethrown once
+// every thread has stopped
+void run_tasks(std::size_t n, unsigned threads, const std::function<void(std::size_t)>& task);
+
+} // namespace optimize
+
+} // namespace bf
@@ -0,0 +1,182 @@
+#include <parse/parallel.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <lex/scan.h>
+#include <lex/token.h>
+
+namespace bf {
+
+namespace parse {
+
+namespace {
+
+// what one thread makes of its chunk. loops that open and close within the
+// chunk are linked already, the others are left for the stitching
+struct chunk {
+  ir::program              code;
+  std::vector<std::size_t> closes; // ']' without a '[' in the chunk, in order
+  std::vector<std::size_t> opens;  // '[' without a ']' in the chunk, outermost first
+
+  // where code[0] lands in the whole program. when merged it carries on the
+  // run the chunks before it ended with and lands on that run
+  std::size_t base   = 0;
+  bool        merged = false;
+};
+
+// the longest run lexer::next_run folds, its count stays representable as a
+// signed amount
+constexpr std::int64_t max_run = std::numeric_limits<std::int32_t>::max();
+
+void parse_chunk(const char* source, const char* first, const char* last, chunk& c) {
+  auto& p = c.code;
+  std::vector<std::size_t> heads;
+  for (auto at = lex::find_command(first, last); at != last;) {
+    auto origin = static_cast<std::size_t>(at - source);
+    switch (static_cast<lex::token_t>(*at)) {
+      case lex::token_t::l_shift:
+      case lex::token_t::r_shift:
+      case lex::token_t::inc:
+      case lex::token_t::dec:
+        {
+          std::int32_t count = 1;
+          auto next = lex::find_command(at + 1, last);
+          while (next != last && *next == *at && count < max_run) {
+            ++count;
+            next = lex::find_command(next + 1, last);
+          }
+          auto op  = *at == '<' || *at == '>' ? ir::op_t::shift : ir::op_t::add;
+          auto arg = *at == '<' || *at == '-' ? -count : count;
+          p.push(op, arg, 0, origin);
+          at = next;
+        }
+        continue;
+      case lex::token_t::out:
+        p.push(ir::op_t::out, 0, 0, origin);
+        break;
+      case lex::token_t::in:
+        p.push(ir::op_t::in, 0, 0, origin);
+        break;
+      case lex::token_t::l_bracket:
+        heads.push_back(p.open_loop(origin));
+        break;
+      case lex::token_t::r_bracket:
+        if (heads.empty()) {
+          c.closes.push_back(p.size());
+          p.push(ir::op_t::jnz, 0, 0, origin);
+        }
+        else {
+          p.close_loop(heads.back(), origin);
+          heads.pop_back();
+        }
+        break;
+      case lex::token_t::eof:
+        break; // not a character
+    }
+    at = lex::find_command(at + 1, last);
+  }
+  c.opens = std::move(heads);
+}
+
+// whether b carries on the run a ended with, as it would have had the two
+// not been lexed apart
+bool carries_on(ir::op_t a_op, std::int64_t a, ir::op_t b_op, std::int64_t b) {
+  return a_op == b_op && (a_op == ir::op_t::add || a_op == ir::op_t::shift) &&
+    (a < 0) == (b < 0) && std::abs(a + b) <= max_run;
+}
+
+void copy_chunk(const chunk& c, ir::program& p) {
+  for (std::size_t i = c.merged ? 1 : 0; i != c.code.size(); ++i) {
+    auto at = c.base + i;
+    p.ops[at]     = c.code.ops[i];
+    p.args[at]    = c.code.args[i];
+    p.offsets[at] = c.code.offsets[i];
+    p.origins[at] = c.code.origins[i];
+    auto is_loop  = c.code.ops[i] == ir::op_t::jz || c.code.ops[i] == ir::op_t::jnz;
+    p.jumps[at]   = is_loop ? static_cast<std::uint32_t>(c.base + c.code.jumps[i]) : 0;
+  }
+}
+
+// runs work(i) for every chunk, the last one on this thread
+template <typename Work>
+void for_each_chunk(std::size_t n, Work work) {
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i + 1 < n; ++i) {
+    threads.emplace_back(work, i);
+  }
+  work(n - 1);
+  for (auto& t : threads) {
+    t.join();
+  }
+}
+
+} // namespace
+
+bool parse_ir_parallel(const char* first, const char* last, unsigned threads, ir::program& p) {
+  auto size = static_cast<std::size_t>(last - first);
+  auto n    = std::max<std::size_t>(1, std::min<std::size_t>(threads, size / min_parallel_chunk));
+
+  // chunks split the source anywhere, a run cut in two is joined up again
+  // when stitching
+  std::vector<chunk> chunks(n);
+  for_each_chunk(n, [&](std::size_t i) {
+    parse_chunk(first, first + size * i / n, first + size * (i + 1) / n, chunks[i]);
+  });
+
+  // lay the chunks out one after the other and match the brackets they left
+  // open across them. only runs and unmatched brackets are looked at here,
+  // which are few compared to the program
+  std::vector<std::pair<std::size_t, std::size_t>> loops;
+  std::vector<std::size_t> heads;
+  std::size_t  total    = 0;
+  ir::op_t     last_op  = ir::op_t::halt;
+  std::int64_t last_arg = 0;
+  for (auto& c : chunks) {
+    c.base = total;
+    if (c.code.empty()) continue;
+
+    c.merged = total != 0 && carries_on(last_op, last_arg, c.code.ops[0], c.code.args[0]);
+    if (c.merged) {
+      c.base   -= 1;
+      last_arg += c.code.args[0];
+    }
+    total = c.base + c.code.size();
+    if (!c.merged || c.code.size() > 1) {
+      last_op  = c.code.ops.back();
+      last_arg = c.code.args.back();
+    }
+
+    for (auto i : c.closes) {
+      if (heads.empty()) return false; // a ']' with nothing to close
+      loops.emplace_back(heads.back(), c.base + i);
+      heads.pop_back();
+    }
+    for (auto i : c.opens) {
+      heads.push_back(c.base + i);
+    }
+  }
+  if (!heads.empty()) return false; // a '[' that is never closed
+
+  p = ir::program{ };
+  p.resize(total);
+  for_each_chunk(n, [&](std::size_t i) { copy_chunk(chunks[i], p); });
+  for (const auto& c : chunks) {
+    if (c.merged) p.args[c.base] += c.code.args[0];
+  }
+  for (const auto& loop : loops) {
+    p.jumps[loop.first]  = static_cast<std::uint32_t>(loop.second);
+    p.jumps[loop.second] = static_cast<std::uint32_t>(loop.first);
+  }
+  return true;
+}
+
+} // namespace parse
+
+} // namespace bf
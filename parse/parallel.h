@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+
+#include <ir/ir.h>
+
+namespace bf {
+
+namespace parse {
+
+// sources are only split into chunks of at least this many bytes, below that
+// starting a thread costs more than it saves
+constexpr std::size_t min_parallel_chunk = 1 << 20;
+
+// parses the source in [first, last) into p the way parser::parse_ir does,
+// split into chunks that are lexed, folded and matched up on up to threads
+// threads and then stitched together. returns false when the program is
+// ill-formed, which only a serial parse can then explain
+bool parse_ir_parallel(const char* first, const char* last, unsigned threads, ir::program& p);
+
+} // namespace parse
+
+} // namespace bf
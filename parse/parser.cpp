@@ -1,9 +1,11 @@
 #include <parse/parser.h>
 
+#include <limits>
 #include <sstream>
 #include <string> // for std::literals::string_literals
 
 #include <lex/lexer.h>
+#include <parse/parallel.h>
 
 // commands
 #include <cmd/arithmetic.h>
@@ -13,15 +15,17 @@
 
 namespace { // utils
 
-std::string make_error_unexpected(const bf::lex::token& tok) {
+std::string make_error_unexpected(const bf::lex::lexer& l, const bf::lex::token& tok) {
+  auto pos = l.locate(tok);
   std::stringstream ss;
-  ss << tok.pos.name << '(' << tok.pos.line << ':' << tok.pos.col << ')' << ": unexpected token: " << static_cast<char>(tok.type);
+  ss << pos.name << '(' << pos.line << ':' << pos.col << ')' << ": unexpected token: " << static_cast<char>(tok.type);
   return ss.str();
 }
 
-std::string make_error_custom(const bf::lex::token& tok, const std::string& msg) {
+std::string make_error_custom(const bf::lex::lexer& l, const bf::lex::token& tok, const std::string& msg) {
+  auto pos = l.locate(tok);
   std::stringstream ss;
-  ss << tok.pos.name << '(' << tok.pos.line << ':' << tok.pos.col << ')' << ": " << msg << " token: " << static_cast<char>(tok.type);
+  ss << pos.name << '(' << pos.line << ':' << pos.col << ')' << ": " << msg << " token: " << static_cast<char>(tok.type);
   return ss.str();
 }
 
@@ -34,7 +38,7 @@ namespace parse {
 bool parser::expect_(lex::token_t tok) {
   if (c_tok_.type != tok) {
     using namespace std::literals;
-    auto str = make_error_unexpected(c_tok_);
+    auto str = make_error_unexpected(lexer_, c_tok_);
     str += " got: "s + static_cast<char>(c_tok_.type);
     return false;
   }
@@ -42,32 +46,32 @@ bool parser::expect_(lex::token_t tok) {
   return true;
 }
 
-std::shared_ptr<cmd::command> parser::parse_stmt_() {
-  std::shared_ptr<cmd::command> stmt;
+const cmd::command* parser::parse_stmt_() {
+  const cmd::command* stmt = nullptr;
 
   switch (c_tok_.type) {
     case lex::token_t::l_shift:
-      stmt = std::make_shared<cmd::shift>(cmd::shift::shift_type::left);
+      stmt = arena_->make<cmd::shift>(cmd::shift::shift_type::left, c_tok_.count);
       break;
     case lex::token_t::r_shift:
-      stmt = std::make_shared<cmd::shift>(cmd::shift::shift_type::right);
+      stmt = arena_->make<cmd::shift>(cmd::shift::shift_type::right, c_tok_.count);
       break;
     case lex::token_t::inc:
-      stmt = std::make_shared<cmd::arithmetic>(cmd::arithmetic::arith_type::add);
+      stmt = arena_->make<cmd::arithmetic>(cmd::arithmetic::arith_type::add, c_tok_.count);
       break;
     case lex::token_t::dec:
-      stmt = std::make_shared<cmd::arithmetic>(cmd::arithmetic::arith_type::sub);
+      stmt = arena_->make<cmd::arithmetic>(cmd::arithmetic::arith_type::sub, c_tok_.count);
       break;
     case lex::token_t::out:
-      stmt = std::make_shared<cmd::io>(cmd::io::io_type::out);
+      stmt = arena_->make<cmd::io>(cmd::io::io_type::out);
       break;
     case lex::token_t::in:
-      stmt = std::make_shared<cmd::io>(cmd::io::io_type::in);
+      stmt = arena_->make<cmd::io>(cmd::io::io_type::in);
       break;
     case lex::token_t::l_bracket:
     case lex::token_t::r_bracket:
     case lex::token_t::eof:
-      errors_.emplace_back(make_error_unexpected(c_tok_));
+      errors_.emplace_back(make_error_unexpected(lexer_, c_tok_));
       return nullptr; // we can't hit this while in a loop
   }
   next_token_(); // eat 'command'
@@ -75,8 +79,10 @@ std::shared_ptr<cmd::command> parser::parse_stmt_() {
   return stmt;
 }
 
-std::shared_ptr<cmd::loop> parser::parse_loop_() {
-  cmd::loop::cmd_list_t commands;
+const cmd::loop* parser::parse_loop_() {
+  // the body is collected on top of pending_ and copied into the arena once
+  // its size is known
+  auto first = pending_.size();
 
   auto c = c_tok_;
   if (!expect_(lex::token_t::l_bracket)) return nullptr; // eat '['
@@ -89,17 +95,17 @@ std::shared_ptr<cmd::loop> parser::parse_loop_() {
       case lex::token_t::dec:
       case lex::token_t::out:
       case lex::token_t::in:
-        commands.emplace_back(parse_stmt_());
+        pending_.push_back(parse_stmt_());
         break;
       case lex::token_t::l_bracket:
         {
           auto loop = parse_loop_();
-          if (loop) commands.emplace_back(std::move(loop));
+          if (loop) pending_.push_back(loop);
           else      return nullptr;
         }
         break;
       case lex::token_t::eof:
-        errors_.emplace_back(make_error_custom(c, "error trying to match"));
+        errors_.emplace_back(make_error_custom(lexer_, c, "error trying to match"));
         errors_.emplace_back("unexpected EOF");
         return nullptr; // we can't hit this while in a loop
       case lex::token_t::r_bracket:
@@ -109,15 +115,19 @@ std::shared_ptr<cmd::loop> parser::parse_loop_() {
 
   if (!expect_(lex::token_t::r_bracket)) return nullptr; // eat ']'
 
-  return std::make_shared<cmd::loop>(std::move(commands));
+  auto body = arena_->copy(pending_.data() + first, pending_.size() - first);
+  pending_.resize(first);
+  return arena_->make<cmd::loop>(body);
 }
 
 void parser::next_token_() {
-  c_tok_ = lexer_.next_token();
+  c_tok_ = lexer_.next_run();
 }
 
 prog::program parser::parse() {
   prog::program p;
+  arena_ = &p.arena();
+  pending_.clear();
 
   next_token_();
   do {
@@ -128,13 +138,13 @@ prog::program parser::parse() {
       case lex::token_t::dec:
       case lex::token_t::out:
       case lex::token_t::in:
-        p.emplace_back(parse_stmt_());
+        p.push_back(parse_stmt_());
         break;
       case lex::token_t::l_bracket:
         {
           auto loop = parse_loop_();
           if (loop) {
-            p.emplace_back(std::move(loop));
+            p.push_back(loop);
           }
           else {
             p.clear(); // ill-formed
@@ -143,7 +153,7 @@ prog::program parser::parse() {
         }
         break;
       case lex::token_t::r_bracket:
-        errors_.emplace_back(make_error_unexpected(c_tok_));
+        errors_.emplace_back(make_error_unexpected(lexer_, c_tok_));
         p.clear(); // ill-formed
         c_tok_.type = lex::token_t::eof;
         break;
@@ -152,9 +162,80 @@ prog::program parser::parse() {
     }
   } while (c_tok_.type != lex::token_t::eof);
 
+  arena_ = nullptr; // p is about to move
   return p;
 }
 
+ir::program parser::parse_ir(unsigned threads) {
+  ir::program p;
+  auto size = static_cast<std::size_t>(lexer_.end() - lexer_.begin());
+  if (!started_ && threads > 1 && size >= 2 * min_parallel_chunk) {
+    if (parse_ir_parallel(lexer_.begin(), lexer_.end(), threads, p)) return p;
+    // ill-formed, the serial parse below says where
+  }
+  parse_ir_part(p, std::numeric_limits<std::size_t>::max());
+  return p;
+}
+
+bool parser::parse_ir_part(ir::program& p, std::size_t size) {
+  p = ir::program{ };
+  std::vector<std::pair<std::size_t, lex::token>> open; // loop heads and their '['
+
+  if (!started_) {
+    next_token_();
+    started_ = true;
+  }
+  while (c_tok_.type != lex::token_t::eof) {
+    switch (c_tok_.type) {
+      case lex::token_t::l_shift:
+        p.push(ir::op_t::shift, -static_cast<std::int32_t>(c_tok_.count), 0, c_tok_.offset);
+        break;
+      case lex::token_t::r_shift:
+        p.push(ir::op_t::shift, static_cast<std::int32_t>(c_tok_.count), 0, c_tok_.offset);
+        break;
+      case lex::token_t::inc:
+        p.push(ir::op_t::add, static_cast<std::int32_t>(c_tok_.count), 0, c_tok_.offset);
+        break;
+      case lex::token_t::dec:
+        p.push(ir::op_t::add, -static_cast<std::int32_t>(c_tok_.count), 0, c_tok_.offset);
+        break;
+      case lex::token_t::out:
+        p.push(ir::op_t::out, 0, 0, c_tok_.offset);
+        break;
+      case lex::token_t::in:
+        p.push(ir::op_t::in, 0, 0, c_tok_.offset);
+        break;
+      case lex::token_t::l_bracket:
+        open.emplace_back(p.open_loop(c_tok_.offset), c_tok_);
+        break;
+      case lex::token_t::r_bracket:
+        if (open.empty()) {
+          errors_.emplace_back(make_error_unexpected(lexer_, c_tok_));
+          p = ir::program{ }; // ill-formed
+          return false;
+        }
+        p.close_loop(open.back().first, c_tok_.offset);
+        open.pop_back();
+        break;
+      case lex::token_t::eof:
+        break; // noop
+    }
+    next_token_();
+
+    // only ever between top-level statements
+    if (open.empty() && p.size() >= size) break;
+  }
+
+  if (!open.empty()) {
+    errors_.emplace_back(make_error_custom(lexer_, open.back().second, "error trying to match"));
+    errors_.emplace_back("unexpected EOF");
+    p = ir::program{ }; // ill-formed
+    return false;
+  }
+
+  return !p.empty();
+}
+
 } // namespace parse
 
 } // namespace bf
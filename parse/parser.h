@@ -1,5 +1,6 @@
 #pragma once
 #include <cmd/program.h>
+#include <ir/ir.h>
 #include <lex/token.h>
 
 namespace bf {
@@ -11,18 +12,30 @@ namespace cmd { struct loop; }
 namespace parse {
 
 class parser {
-  lex::lexer&              lexer_;
-  lex::token               c_tok_;
-  std::vector<std::string> errors_;
+  lex::lexer&                      lexer_;
+  lex::token_run                   c_tok_;
+  std::vector<std::string>         errors_;
+  cmd::arena*                      arena_;
+  std::vector<const cmd::command*> pending_; // statements of the open loops
+  bool                             started_;  // the first token has been read
 
   bool expect_(lex::token_t tok);
-  std::shared_ptr<cmd::command> parse_stmt_();
-  std::shared_ptr<cmd::loop>    parse_loop_();
+  const cmd::command* parse_stmt_();
+  const cmd::loop*    parse_loop_();
   void next_token_();
 public:
-  parser(lex::lexer& lexer) : lexer_{ lexer } { }
+  parser(lex::lexer& lexer) : lexer_{ lexer }, arena_{ nullptr }, started_{ false } { }
 
   prog::program parse();
+  // parses straight into the flat representation without building a tree.
+  // large sources are split up across up to threads threads
+  ir::program parse_ir(unsigned threads = 1);
+  // parses the source a part at a time into p, which is replaced. a part is
+  // whole top-level statements, as many as it takes to reach size
+  // instructions, so it is only ever larger than that by the last top-level
+  // loop. returns false once the source is used up, or with p empty and
+  // errors() filled in when it is ill-formed
+  bool parse_ir_part(ir::program& p, std::size_t size);
   const std::vector<std::string>& errors() { return errors_; }
 };
 
@@ -0,0 +1,27 @@
+#include <runtime/io.h>
+
+#include <cstdio>
+
+namespace bf {
+
+namespace runtime {
+
+io::~io() {
+  flush();
+}
+
+std::uint8_t io::get() {
+  flush(); // make sure any prompt is visible before we block
+  int c = std::getchar();
+  return c == EOF ? 0 : static_cast<std::uint8_t>(c);
+}
+
+void io::flush() {
+  std::fwrite(buffer_, 1, used_, stdout);
+  std::fflush(stdout);
+  used_ = 0;
+}
+
+} // namespace runtime
+
+} // namespace bf
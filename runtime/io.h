@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace bf {
+
+namespace runtime {
+
+// console I/O for natively executed programs. reading past the end of input
+// yields '\0', the same EOF the generated webpage hands out. output is held
+// in a buffer that is written out when it fills, before every read and on
+// flush()
+class io {
+  static constexpr std::size_t buffer_size = 1u << 16;
+
+  std::uint8_t buffer_[buffer_size];
+  std::size_t  used_ = 0;
+public:
+  io() = default;
+  ~io();
+
+  io(const io&)            = delete;
+  io& operator=(const io&) = delete;
+
+  std::uint8_t get();
+  void put(std::uint8_t c) {
+    if (used_ == buffer_size) flush();
+    buffer_[used_++] = c;
+  }
+  void flush();
+};
+
+} // namespace runtime
+
+} // namespace bf
@@ -0,0 +1,126 @@
+#include <runtime/scan.h>
+
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define BF_SCAN_X86 1
+#include <immintrin.h>
+#else
+#define BF_SCAN_X86 0
+#endif
+
+namespace bf {
+
+namespace runtime {
+
+static std::uint8_t* find_zero_scalar(std::uint8_t* cell, std::int32_t stride, std::uint8_t* first, std::uint8_t* last) {
+  auto size = static_cast<std::size_t>(last - first);
+  while (*cell) {
+    // a single unsigned compare catches running off either end
+    if (static_cast<std::size_t>(cell - first + stride) >= size) return nullptr;
+    cell += stride;
+  }
+  return cell;
+}
+
+#if BF_SCAN_X86
+
+// instead of gathering every stride-th cell, a block of width cells is tested
+// whole and the lanes that are not on the walk are masked off. blocks always
+// start on the walk so one mask serves every block: bits 0, stride,
+// 2 * stride, ... for walking right and the same from the top bit down for
+// walking left. each block advances by the last multiple of stride that fits
+static std::uint32_t walk_mask(std::uint32_t width, std::uint32_t stride, bool left) {
+  std::uint32_t mask = 0;
+  for (std::uint32_t i = 0; i < width; i += stride) {
+    mask |= 1u << (left ? width - 1 - i : i);
+  }
+  return mask;
+}
+
+static std::uint8_t* find_zero_sse2(std::uint8_t* cell, std::int32_t stride, std::uint8_t* first, std::uint8_t* last) {
+  constexpr std::int32_t width = 16;
+  if (stride > width || stride < -width) return find_zero_scalar(cell, stride, first, last);
+
+  auto zero = _mm_setzero_si128();
+  if (stride > 0) {
+    auto mask = walk_mask(width, stride, false);
+    auto step = width - width % stride;
+    while (last - cell >= width) {
+      auto x  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cell));
+      auto at = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero))) & mask;
+      if (at != 0) return cell + __builtin_ctz(at);
+      cell += step;
+    }
+    if (cell == last) return nullptr;
+  }
+  else {
+    auto mask = walk_mask(width, -stride, true);
+    auto step = width - width % -stride;
+    while (cell - first + 1 >= width) {
+      auto x  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cell - (width - 1)));
+      auto at = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, zero))) & mask;
+      if (at != 0) return cell - (width - 1) + (31 - __builtin_clz(at));
+      cell -= step;
+    }
+    if (cell < first) return nullptr;
+  }
+  return find_zero_scalar(cell, stride, first, last);
+}
+
+__attribute__((target("avx2")))
+static std::uint8_t* find_zero_avx2(std::uint8_t* cell, std::int32_t stride, std::uint8_t* first, std::uint8_t* last) {
+  constexpr std::int32_t width = 32;
+  if (stride > width || stride < -width) return find_zero_scalar(cell, stride, first, last);
+
+  auto zero = _mm256_setzero_si256();
+  if (stride > 0) {
+    auto mask = walk_mask(width, stride, false);
+    auto step = width - width % stride;
+    while (last - cell >= width) {
+      auto x  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cell));
+      auto at = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, zero))) & mask;
+      if (at != 0) return cell + __builtin_ctz(at);
+      cell += step;
+    }
+    if (cell == last) return nullptr;
+  }
+  else {
+    auto mask = walk_mask(width, -stride, true);
+    auto step = width - width % -stride;
+    while (cell - first + 1 >= width) {
+      auto x  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cell - (width - 1)));
+      auto at = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, zero))) & mask;
+      if (at != 0) return cell - (width - 1) + (31 - __builtin_clz(at));
+      cell -= step;
+    }
+    if (cell < first) return nullptr;
+  }
+  return find_zero_sse2(cell, stride, first, last);
+}
+
+using find_fn = std::uint8_t* (*)(std::uint8_t*, std::int32_t, std::uint8_t*, std::uint8_t*);
+
+static find_fn select_find() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") ? find_zero_avx2 : find_zero_sse2;
+}
+
+static const find_fn find_impl = select_find();
+
+#else
+
+static const auto find_impl = find_zero_scalar;
+
+#endif
+
+std::uint8_t* find_zero(std::uint8_t* cell, std::int32_t stride, std::uint8_t* first, std::uint8_t* last) {
+  // most scans start on a zero cell or stop a few cells away, don't pay for
+  // a vector load when the walk is already over
+  if (*cell == 0) return cell;
+  return find_impl(cell, stride, first, last);
+}
+
+} // namespace runtime
+
+} // namespace bf
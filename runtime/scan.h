@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+namespace bf {
+
+namespace runtime {
+
+// the first zero among cell, cell + stride, cell + 2 * stride, ... which is
+// what a [>], [<<] or similar loop stops on. returns nullptr if the walk
+// leaves [first, last) before finding one. cell must be in [first, last).
+// strides up to the vector width test 16 or 32 cells at a time when the host
+// supports SSE2/AVX2
+std::uint8_t* find_zero(std::uint8_t* cell, std::int32_t stride, std::uint8_t* first, std::uint8_t* last);
+
+} // namespace runtime
+
+} // namespace bf
@@ -0,0 +1,24 @@
+#include <runtime/tape.h>
+
+#include <cstdlib>
+
+#include <new>
+
+namespace bf {
+
+namespace runtime {
+
+tape::tape(std::size_t size, std::size_t margin):
+  cells_{ static_cast<std::uint8_t*>(std::calloc(size + 2 * margin, 1)) },
+  size_{ size },
+  margin_{ margin } {
+  if (!cells_) throw std::bad_alloc{ };
+}
+
+tape::~tape() {
+  std::free(cells_);
+}
+
+} // namespace runtime
+
+} // namespace bf
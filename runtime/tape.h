@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace bf {
+
+namespace runtime {
+
+// the memory a program operates on. cells are zero initialized lazily by the
+// allocator so a large tape costs nothing until it is touched. margin cells on
+// either side are addressable but outside [begin(), end()), for code that only
+// checks the bounds when the pointer itself moves
+class tape {
+  std::uint8_t* cells_;
+  std::size_t   size_;
+  std::size_t   margin_;
+public:
+  static constexpr std::size_t default_size = 1u << 24;
+
+  explicit tape(std::size_t size = default_size, std::size_t margin = 0);
+  ~tape();
+
+  tape(const tape&)            = delete;
+  tape& operator=(const tape&) = delete;
+
+  std::uint8_t* begin()      { return cells_ + margin_; }
+  std::uint8_t* end()        { return cells_ + margin_ + size_; }
+  std::size_t   size() const { return size_; }
+};
+
+} // namespace runtime
+
+} // namespace bf